@@ -0,0 +1,117 @@
+/*	Brian Kirkpatrick
+	Pac-Man: Vengeance
+	Bit grid class
+	Begun Saturday, October 17th, 2026
+
+	The bit grid class stores a 2d array of flags, one bit each. Rows are padded out to whole 64-bit words (padding
+	bits are always clear), so entire rows can be read, written and combined a word at a time.
+*/
+
+#include "BitGrid.h"
+
+// --- Constructors --- //
+
+BitGrid::BitGrid() {
+	width = 0;
+	height = 0;
+	rowWords = 0;
+	words = NULL;
+}
+
+BitGrid::~BitGrid() {
+	if (words != NULL) {
+		delete[] words;
+		words = NULL;
+	}
+}
+
+// --- Accessors --- //
+
+bool BitGrid::get(int x, int y) {
+	if (x < 0 || x >= width || y < 0 || y >= height) return false;
+	return (words[y * rowWords + x / 64] >> (x % 64)) & 1;
+}
+
+int BitGrid::getHeight() {
+	return height;
+}
+
+int BitGrid::getRowWords() {
+	return rowWords;
+}
+
+int BitGrid::getWidth() {
+	return width;
+}
+
+size_t BitGrid::getBytes() {
+	return (size_t)rowWords * height * sizeof(uint64_t);
+}
+
+uint64_t * BitGrid::getRow(int y) {
+	return &(words[y * rowWords]);
+}
+
+uint64_t BitGrid::getRowMask(int word) {
+	// All ones, except past the end of the last word
+	int valid = width - 64 * word;
+	if (valid >= 64) return ~(uint64_t)0;
+	if (valid <= 0) return 0;
+	return ((uint64_t)1 << valid) - 1;
+}
+
+void BitGrid::set(int x, int y, bool b) {
+	if (x < 0 || x >= width || y < 0 || y >= height) return;
+	uint64_t bit = (uint64_t)1 << (x % 64);
+	if (b) {
+		words[y * rowWords + x / 64] |= bit;
+	} else {
+		words[y * rowWords + x / 64] &= ~bit;
+	}
+}
+
+// --- Methods --- //
+
+bool BitGrid::all() {
+	// True if every (non-padding) bit is set
+	for (int j = 0; j < height; j++) {
+		uint64_t * row = getRow(j);
+		for (int k = 0; k < rowWords; k++) {
+			if (row[k] != getRowMask(k)) return false;
+		}
+	}
+	return true;
+}
+
+void BitGrid::fill(bool b) {
+	for (int j = 0; j < height; j++) {
+		fillRow(j, b);
+	}
+}
+
+void BitGrid::fillRow(int y, bool b) {
+	if (y < 0 || y >= height) return;
+	uint64_t * row = getRow(y);
+	for (int k = 0; k < rowWords; k++) {
+		row[k] = b ? getRowMask(k) : 0;
+	}
+}
+
+void BitGrid::merge(BitGrid * other) {
+	if (other == NULL || other->width != width || other->height != height) return;
+	for (int i = 0; i < rowWords * height; i++) {
+		words[i] |= other->words[i];
+	}
+}
+
+void BitGrid::resize(int w, int h) {
+	width = w > 0 ? w : 0;
+	height = h > 0 ? h : 0;
+	rowWords = (width + 63) / 64;
+	if (words != NULL) {
+		delete[] words;
+		words = NULL;
+	}
+	words = new uint64_t[rowWords * height > 0 ? rowWords * height : 1];
+	fill(false);
+}
@@ -0,0 +1,45 @@
+/*	Brian Kirkpatrick
+	Pac-Man: Vengeance
+	Bit grid class
+	Begun Saturday, October 17th, 2026
+
+	The bit grid class stores a 2d array of flags, one bit each. Rows are padded out to whole 64-bit words (padding
+	bits are always clear), so entire rows can be read, written and combined a word at a time.
+*/
+
+#ifndef BIT_GRID_CLASS_H
+#define BIT_GRID_CLASS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+class BitGrid {
+private:
+	int width, height;
+	int rowWords;		// 64-bit words per row
+	uint64_t * words;
+protected:
+public:
+	// Constructors
+	BitGrid();
+	~BitGrid();
+
+	// Accessors
+	bool get(int x, int y);				// Out-of-bounds bits read as clear
+	int getHeight();
+	int getRowWords();
+	int getWidth();
+	size_t getBytes();
+	uint64_t * getRow(int y);
+	uint64_t getRowMask(int word);		// Valid (non-padding) bits of the given word in any row
+	void set(int x, int y, bool b=true);	// Out-of-bounds writes are ignored
+
+	// Methods
+	bool all();
+	void fill(bool b);
+	void fillRow(int y, bool b);
+	void merge(BitGrid * other);		// Sets every bit that is set in other; dimensions must match
+	void resize(int w, int h);			// Contents are cleared
+};
+
+#endif
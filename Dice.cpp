@@ -3,41 +3,102 @@
 	Dice class
 	Begun Monday, May 3rd, 2010
 
-	The dice class enables easy access to the rand.h qRNG in several modes and ranges
+	The dice class is a small, fast pseudo-random generator (xoshiro256**) with rolls in several modes and ranges.
+	Each die has its own state, seeded explicitly or from the clock, so separate dice never interfere with each other
+	(or need locking across threads) and any sequence of rolls can be replayed from its seed. Integer rolls are
+	unbiased; float rolls have 24 bits of resolution.
 */
 
 #include "Dice.h"
+#include <chrono>
+
+static uint64_t rotateLeft(uint64_t x, int k) {
+	return (x << k) | (x >> (64 - k));
+}
+
+static uint64_t splitMix(uint64_t * x) {
+	// Expands one seed into well-mixed state words
+	uint64_t z = (*x += 0x9E3779B97F4A7C15ULL);
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+	return z ^ (z >> 31);
+}
 
 // --- Constructors --- //
 
 Dice::Dice() {
-	// Initialize with time-based random seed and roll once
-	srand((unsigned)time(0));
-	float f = roll();
+	// Clock ticks, mixed with this die's address so dice made in the same tick still differ
+	uint64_t ticks = (uint64_t)std::chrono::high_resolution_clock::now().time_since_epoch().count();
+	setSeed(ticks ^ ((uint64_t)(uintptr_t)this << 16));
+}
+
+Dice::Dice(uint64_t s) {
+	setSeed(s);
 }
 
 Dice::~Dice() {
 	// Nothing to destroy
 }
 
+// --- Private Methods --- //
+
+uint32_t Dice::rollBelow(uint32_t range) {
+	// Lemire's multiply-shift, rejecting the few low products that would bias the result
+	uint64_t product = (next() >> 32) * (uint64_t)range;
+	uint32_t low = (uint32_t)product;
+	if (low < range) {
+		uint32_t threshold = (0u - range) % range;
+		while (low < threshold) {
+			product = (next() >> 32) * (uint64_t)range;
+			low = (uint32_t)product;
+		}
+	}
+	return (uint32_t)(product >> 32);
+}
+
+// --- Accessors --- //
+
+uint64_t Dice::getSeed() {
+	return seed;
+}
+
+void Dice::setSeed(uint64_t s) {
+	seed = s;
+	uint64_t x = s;
+	for (int i = 0; i < 4; i++) {
+		state[i] = splitMix(&x);
+	}
+}
+
 // --- Methods --- //
 
+uint64_t Dice::next() {
+	uint64_t result = rotateLeft(state[1] * 5, 7) * 9;
+	uint64_t t = state[1] << 17;
+	state[2] ^= state[0];
+	state[3] ^= state[1];
+	state[1] ^= state[2];
+	state[0] ^= state[3];
+	state[2] ^= t;
+	state[3] = rotateLeft(state[3], 45);
+	return result;
+}
+
 float Dice::roll() {
 	// Return random float between 0 and 1 (limited resolution)
-	return (float)rand() / RAND_MAX;
+	return (float)(next() >> 40) * (1.0f / 16777216.0f);
 }
 
 int Dice::rollInt(int sides){
 	// Return random integer between 0 and sides-1
-	return rand() % sides;
+	if (sides <= 1) return 0;
+	return (int)rollBelow((uint32_t)sides);
 }
 
 int Dice::rollIntRange(int low, int high) {
 	// Return random integer between low and high, inclusive
 	if (low >= high) high = low + 1;
-	int randomInt = rand();
-	int moddedInt = randomInt % (high - low + 1);
-	return moddedInt + low;
+	return low + (int)rollBelow((uint32_t)(high - low) + 1);
 }
 
 float Dice::rollFloat(float limit) {
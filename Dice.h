@@ -3,24 +3,37 @@
 	Dice class
 	Begun Monday, May 3rd, 2010
 
-	The dice class enables easy access to the rand.h qRNG in several modes and ranges
+	The dice class is a small, fast pseudo-random generator (xoshiro256**) with rolls in several modes and ranges.
+	Each die has its own state, seeded explicitly or from the clock, so separate dice never interfere with each other
+	(or need locking across threads) and any sequence of rolls can be replayed from its seed. Integer rolls are
+	unbiased; float rolls have 24 bits of resolution.
 */
 
 #ifndef DICE_CLASS_H
 #define DICE_CLASS_H
 
 #include <stdlib.h>
+#include <stdint.h>
 #include <time.h>
 
 class Dice {
 private:
+	uint64_t seed;
+	uint64_t state[4];
+	uint32_t rollBelow(uint32_t range);	// Unbiased, 0 to range-1
 protected:
 public:
 	// Constructors
-	Dice();
+	Dice();									// Seeded from the clock; not reproducible
+	Dice(uint64_t s);
 	~Dice();
 
+	// Accessors
+	uint64_t getSeed();
+	void setSeed(uint64_t s);				// Restarts the sequence
+
 	// Methods
+	uint64_t next();							// Raw 64 bits
 	float roll();								// 0-1
 	int rollInt(int sides);						// Exclusive
 	int rollIntRange(int low, int high);		// Inclusive
@@ -28,4 +41,4 @@ public:
 	float rollFloatRange(float low, float high);// Inclusive; limited resolution
 };
 
-#endif
\ No newline at end of file
+#endif
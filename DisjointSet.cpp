@@ -0,0 +1,80 @@
+/*	Brian Kirkpatrick
+	Pac-Man: Vengeance
+	Disjoint set class
+	Begun Saturday, October 17th, 2026
+
+	The disjoint set class tracks which of n elements are joined together (union-find), with union by rank and path
+	halving so that merges and lookups run in near-constant time
+*/
+
+#include "DisjointSet.h"
+#include <stdlib.h>
+
+// --- Constructors --- //
+
+DisjointSet::DisjointSet() {
+	size = 0;
+	count = 0;
+	parents = NULL;
+	ranks = NULL;
+}
+
+DisjointSet::~DisjointSet() {
+	if (parents != NULL) {
+		delete[] parents;
+		parents = NULL;
+	}
+	if (ranks != NULL) {
+		delete[] ranks;
+		ranks = NULL;
+	}
+}
+
+// --- Methods --- //
+
+int DisjointSet::find(int n) {
+	// Walk up to the root, pointing every other node at its grandparent along the way
+	if (n < 0 || n >= count) return -1;
+	while (parents[n] != n) {
+		parents[n] = parents[parents[n]];
+		n = parents[n];
+	}
+	return n;
+}
+
+bool DisjointSet::isJoined(int a, int b) {
+	a = find(a);
+	return a != -1 && a == find(b);
+}
+
+bool DisjointSet::merge(int a, int b) {
+	// Hang the shallower tree beneath the deeper one
+	a = find(a);
+	b = find(b);
+	if (a == -1 || b == -1 || a == b) return false;
+	if (ranks[a] < ranks[b]) {
+		parents[a] = b;
+	} else if (ranks[a] > ranks[b]) {
+		parents[b] = a;
+	} else {
+		parents[b] = a;
+		ranks[a]++;
+	}
+	return true;
+}
+
+void DisjointSet::reset(int n) {
+	// Reallocate only when growing
+	if (n > size) {
+		if (parents != NULL) delete[] parents;
+		if (ranks != NULL) delete[] ranks;
+		parents = new int[n];
+		ranks = new unsigned char[n];
+		size = n;
+	}
+	count = n > 0 ? n : 0;
+	for (int i = 0; i < n; i++) {
+		parents[i] = i;
+		ranks[i] = 0;
+	}
+}
@@ -0,0 +1,32 @@
+/*	Brian Kirkpatrick
+	Pac-Man: Vengeance
+	Disjoint set class
+	Begun Saturday, October 17th, 2026
+
+	The disjoint set class tracks which of n elements are joined together (union-find), with union by rank and path
+	halving so that merges and lookups run in near-constant time
+*/
+
+#ifndef DISJOINT_SET_CLASS_H
+#define DISJOINT_SET_CLASS_H
+
+class DisjointSet {
+private:
+	int size;			// Allocated
+	int count;			// In use, since the last reset
+	int * parents;
+	unsigned char * ranks;
+protected:
+public:
+	// Constructors
+	DisjointSet();
+	~DisjointSet();
+
+	// Methods
+	int find(int n);					// Representative element of n's set; -1 if n is out of range
+	bool isJoined(int a, int b);		// False if either is out of range
+	bool merge(int a, int b);			// False if already joined, or either is out of range
+	void reset(int n);					// n singleton sets, 0 to n-1
+};
+
+#endif
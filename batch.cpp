@@ -0,0 +1,144 @@
+/*	Brian Kirkpatrick
+	Pac-Man: Vengeance
+	Batch simulation entry point
+	Begun Saturday, October 17th, 2026
+
+	Plays many levels headless with scripted ghosts and reports how they went, for tuning difficulty:
+
+	  VengeanceBatch [--levels n] [--first level] [--last level] [--threads n] [--steps n] [--seed n]
+	                 [--controller chase|ambush] [--pacmen n] [--ghosts n] [--record prefix]
+
+	Level i of the batch is played from seed+i, so any level can be replayed in the game or on its own. With --record,
+	level i's match is also saved as prefix-i.vmr, for VengeanceReplay.
+
+	Stress mode generates and floods one WxH maze with each algorithm (or just the one given), logs how long each took
+	and exits non-zero if any was not fully accessible. The maze must be at least MAZE_MIN_W x MAZE_MIN_H (4x2):
+
+	  VengeanceBatch --stress WxH [--algorithm division|prim|kruskal|backtrack] [--seed n]
+*/
+
+#include "vBatchRunner.h"
+#include "vGhostController.h"
+#include "vMaze.h"
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char * algNames[] = { "division", "prim", "kruskal", "backtrack" };
+
+static int runStress(int w, int h, const char * algorithmName, bool hasSeed, unsigned long long seed) {
+	vMaze * maze = new vMaze();
+	if (hasSeed) maze->setSeed((uint64_t)seed);
+	int failures = 0;
+	int numRun = 0;
+	for (int a = 0; a < 4; a++) {
+		if (algorithmName != NULL && strcmp(algorithmName, algNames[a]) != 0) continue;
+		numRun++;
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		bool accessible = maze->stressTest(w, h, (MazeAlg)a);
+		double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		printf("Stress test (%s): %dx%d %s in %.0fms\n", algNames[a], w, h, accessible ? "fully accessible" : "NOT ACCESSIBLE", 1000.0 * seconds);
+		if (!accessible) failures++;
+	}
+	delete maze;
+	if (numRun == 0) {
+		fprintf(stderr, "Unknown algorithm %s\n", algorithmName);
+		return 1;
+	}
+	return failures == 0 ? 0 : 1;
+}
+
+int main(int argc, char * argv[]) {
+	int numLevels = 1000;
+	int firstLevel = 1;
+	int lastLevel = 8;
+	int numThreads = 0;
+	int maxSteps = 6000;
+	int numPacmen = 1;
+	int numGhosts = 4;
+	const char * controllerName = "chase";
+	const char * recordPrefix = NULL;
+	const char * stressSize = NULL;
+	const char * algorithmName = NULL;
+	bool hasSeed = false;
+	unsigned long long seed = 0;
+
+	// Every option takes a value
+	for (int i = 1; i < argc; i++) {
+		if (i + 1 >= argc) {
+			fprintf(stderr, "Missing value for %s\n", argv[i]);
+			return 1;
+		}
+		if (strcmp(argv[i], "--levels") == 0) {
+			numLevels = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "--first") == 0) {
+			firstLevel = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "--last") == 0) {
+			lastLevel = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "--threads") == 0) {
+			numThreads = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "--steps") == 0) {
+			maxSteps = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "--seed") == 0) {
+			seed = strtoull(argv[++i], NULL, 10);
+			hasSeed = true;
+		} else if (strcmp(argv[i], "--pacmen") == 0) {
+			numPacmen = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "--ghosts") == 0) {
+			numGhosts = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "--controller") == 0) {
+			controllerName = argv[++i];
+		} else if (strcmp(argv[i], "--record") == 0) {
+			recordPrefix = argv[++i];
+		} else if (strcmp(argv[i], "--stress") == 0) {
+			stressSize = argv[++i];
+		} else if (strcmp(argv[i], "--algorithm") == 0) {
+			algorithmName = argv[++i];
+		} else {
+			fprintf(stderr, "Unknown option %s\n", argv[i]);
+			return 1;
+		}
+	}
+
+	if (stressSize != NULL) {
+		int w = 0, h = 0;
+		if (sscanf(stressSize, "%dx%d", &w, &h) != 2 || w < MAZE_MIN_W || h < MAZE_MIN_H) {
+			fprintf(stderr, "Bad maze size %s; usage: --stress WxH, with W >= %d and H >= %d\n", stressSize, MAZE_MIN_W, MAZE_MIN_H);
+			return 1;
+		}
+		return runStress(w, h, algorithmName, hasSeed, seed);
+	}
+
+	vGhostController * controller = NULL;
+	if (strcmp(controllerName, "chase") == 0) {
+		controller = new vChaseController();
+	} else if (strcmp(controllerName, "ambush") == 0) {
+		controller = new vAmbushController();
+	} else {
+		fprintf(stderr, "Unknown controller %s\n", controllerName);
+		return 1;
+	}
+
+	vBatchRunner * runner = new vBatchRunner(controller);
+	runner->setNumThreads(numThreads);
+	runner->setMaxSteps(maxSteps);
+	runner->setPopulation(numPacmen, numGhosts);
+	runner->setRecordPrefix(recordPrefix);
+	if (hasSeed) runner->setSeed((uint64_t)seed);
+	batchStats stats = runner->run(numLevels, firstLevel, lastLevel);
+
+	// Report
+	printf("Levels %d-%d, %d pacmen, %d %s ghosts, %d steps max, seed %llu\n", firstLevel, lastLevel < firstLevel ? firstLevel : lastLevel, runner->getNumPacmen(), runner->getNumGhosts(), controllerName, runner->getMaxSteps(), (unsigned long long)runner->getSeed());
+	printf("Played:       %d\n", stats.levelsPlayed);
+	printf("Wins:         %d\n", stats.wins);
+	printf("Losses:       %d\n", stats.losses);
+	printf("Draws:        %d\n", stats.draws);
+	printf("Points saved: %lld (%.1f per win)\n", stats.pointsSaved, stats.wins > 0 ? (double)stats.pointsSaved / stats.wins : 0.0);
+	printf("Points eaten: %lld (%.1f per level)\n", stats.pointsEaten, stats.levelsPlayed > 0 ? (double)stats.pointsEaten / stats.levelsPlayed : 0.0);
+	printf("Time:         %.3fs, %.1f levels/s, %.0f steps/s\n", stats.seconds, stats.seconds > 0.0 ? stats.levelsPlayed / stats.seconds : 0.0, stats.seconds > 0.0 ? stats.steps / stats.seconds : 0.0);
+
+	delete runner;
+	delete controller;
+	return 0;
+}
@@ -44,21 +44,25 @@ bool arrowRight() {
 
 void moveUp() {
 	game->debug(kString("Moving up..."));
+	recordInput(MI_TURN, MD_UP);
 	maze->turnActor(maze->getSelection(), MD_UP);
 }
 
 void moveDown() {
 	game->debug(kString("Moving down..."));
+	recordInput(MI_TURN, MD_DOWN);
 	maze->turnActor(maze->getSelection(), MD_DOWN);
 }
 
 void moveLeft() {
 	game->debug(kString("Moving left..."));
+	recordInput(MI_TURN, MD_LEFT);
 	maze->turnActor(maze->getSelection(), MD_LEFT);
 }
 
 void moveRight() {
 	game->debug(kString("Moving right..."));
+	recordInput(MI_TURN, MD_RIGHT);
 	maze->turnActor(maze->getSelection(), MD_RIGHT);
 }
 
@@ -68,6 +72,7 @@ bool pressSpacebar() {
 
 void toggleSelection() {
 	game->debug(kString("Rotating selection..."));
+	recording->addInput(MI_ROTATE_SELECTION);
 	maze->rotateSelection();
 }
 
@@ -77,7 +82,8 @@ bool pressN() {
 
 void newMaze() {
 	game->debug(kString("Generating new maze..."));
-	maze->newLevel(game->hGraphics);
+	maze->newLevel();
+	recording->begin(maze, (float)timestep->getStepLength());
 }
 
 bool pressD() {
@@ -183,9 +189,11 @@ bool pressP() {
 void togglePaused() {
 	if (maze->getIsPaused()) {
 		game->debug("Unpausing game...");
+		recording->addInput(MI_UNPAUSE);
 		maze->unpause();
 	} else {
 		game->debug("Pausing game...");
+		recording->addInput(MI_PAUSE);
 		maze->pause();
 	}
 }
@@ -196,15 +204,14 @@ bool pressE() {
 
 void executeAbility() {
 	// Execute ability; play noise if successful
+	recordInput(MI_ABILITY);
 	if (maze->executeAbility(maze->getSelection())) {
 		maze->setSoundFlag(8, true);
 	}
 }
 
 bool endLevelStartupTrigger() {
-	time_t currTime;
-	time(&currTime);
-	return currState == VS_LEVEL_START && difftime(currTime, lastStateChange) >= 3;
+	return currState == VS_LEVEL_START && maze->getTime() - lastStateChange >= 3;
 }
 
 void endLevelStartupAction() {
@@ -212,7 +219,7 @@ void endLevelStartupAction() {
 }
 
 bool endLevelPlayWinTrigger() {
-	return currState == VS_LEVEL_PLAY && !maze->pacman->getIsAlive();
+	return currState == VS_LEVEL_PLAY && maze->getNumAlivePacmen() == 0;
 }
 
 void endLevelPlayWinAction() {
@@ -220,7 +227,7 @@ void endLevelPlayWinAction() {
 }
 
 bool endLevelPlayLoseTrigger() {
-	return currState == VS_LEVEL_PLAY && !maze->blinky->getIsAlive() && !maze->pinky->getIsAlive() && !maze->inky->getIsAlive() && !maze->clyde->getIsAlive();
+	return currState == VS_LEVEL_PLAY && maze->getNumAliveGhosts() == 0;
 }
 
 void endLevelPlayLoseAction() {
@@ -228,9 +235,7 @@ void endLevelPlayLoseAction() {
 }
 
 bool endVictoryTrigger() {
-	time_t currTime;
-	time(&currTime);
-	return currState == VS_VICTORY && difftime(currTime, lastStateChange) >= 3;
+	return currState == VS_VICTORY && maze->getTime() - lastStateChange >= 3;
 }
 
 void endVictoryAction() {
@@ -238,9 +243,7 @@ void endVictoryAction() {
 }
 
 bool endDefeatTrigger() {
-	time_t currTime;
-	time(&currTime);
-	return currState == VS_DEFEAT && difftime(currTime, lastStateChange) >= 3 && game->hKeyboard->checkPressDown(' ');
+	return currState == VS_DEFEAT && maze->getTime() - lastStateChange >= 3 && game->hKeyboard->checkPressDown(' ');
 }
 
 void endDefeatAction() {
@@ -252,7 +255,7 @@ bool levelBlinkyTrigger() {
 }
 
 void levelBlinkyAction() {
-	maze->blinky->levelUp();
+	maze->levelUpType(V_RED_G);
 	changeState(VS_LEVEL_START);
 }
 
@@ -261,7 +264,7 @@ bool levelPinkyTrigger() {
 }
 
 void levelPinkyAction() {
-	maze->pinky->levelUp();
+	maze->levelUpType(V_PINK_G);
 	changeState(VS_LEVEL_START);
 }
 
@@ -270,7 +273,7 @@ bool levelInkyTrigger() {
 }
 
 void levelInkyAction() {
-	maze->inky->levelUp();
+	maze->levelUpType(V_BLUE_G);
 	changeState(VS_LEVEL_START);
 }
 
@@ -279,6 +282,6 @@ bool levelClydeTrigger() {
 }
 
 void levelClydeAction() {
-	maze->clyde->levelUp();
+	maze->levelUpType(V_ORANGE_G);
 	changeState(VS_LEVEL_START);
 }
@@ -5,18 +5,15 @@
 */
 
 #include <libArtemis.h>
+#include <chrono>
 #include <time.h>
 #include <math.h>
+#include <stdio.h>
 
 // --- Game State Management --- //
 enum VengeanceState { VS_LEVEL_START, VS_LEVEL_PLAY, VS_VICTORY, VS_DEFEAT, VS_LEVELING };
 VengeanceState currState, prevState;
-time_t lastStateChange;
-
-void changeState(VengeanceState newState) {
-	currState = newState;
-	time(&lastStateChange);
-}
+double lastStateChange;	// Maze clock time, in seconds
 
 // --- Game Messages --- //
 bool showHelpMsg = false;
@@ -42,10 +39,36 @@ Mix_Chunk * snd8;
 // --- Game Classes --- //
 #include "vSprite.h"
 #include "vMaze.h"
+#include "vMatchRecord.h"
+#include "vRenderer.h"
+#include "vTimestep.h"
 
 // --- Game objects --- //
 vMaze * maze;
+vRenderer * renderer;
 vSprite * ghostTip;
+vTimestep * timestep;
+vMatchRecord * recording;	// The level being played, saved when it ends for VengeanceReplay
+std::chrono::steady_clock::time_point lastFrame;
+
+void changeState(VengeanceState newState) {
+	currState = newState;
+	lastStateChange = maze->getTime();
+}
+
+void recordInput(matchInputType type, MazeDirection direction=MD_NONE) {
+	// Inputs act on the current selection, so they are recorded against its slot
+	vActor * selection = maze->getSelection();
+	recording->addInput(type, selection != NULL ? selection->getSlot() : -1, direction);
+}
+
+void saveRecording() {
+	char filename[64];
+	sprintf(filename, "match-%d-%llu.vmr", recording->getLevel(), (unsigned long long)recording->getLevelSeed());
+	if (!recording->save(filename)) {
+		game->debug(kString("Could not save ") + filename);
+	}
+}
 
 // --- Game Mechanics --- //
 #include "events.cpp"
@@ -90,36 +113,35 @@ void renderInterface() {
 	ScreenDimension sd2 = ScreenDimension(); sd2.value = 816.0f;
 	kString selectionSummary;
 	vActor * currentSelection = maze->getSelection();
-	time_t currTime;
-	time(&currTime);
+	double currTime = maze->getTime();
 
 	// Determine text
 	switch (currentSelection->getType()) {
 		case V_RED_G:
 			selectionSummary = kString("Blinky   Level: ") + currentSelection->getLevel();
 			// Only show ability description if not on cooldown
-			if (difftime(currTime, currentSelection->getAbilityTriggered()) > 2 * currentSelection->getLevel() && currentSelection->getLevel() > 0) {
+			if (currTime - currentSelection->getAbilityTriggered() > 2 * currentSelection->getLevel() && currentSelection->getLevel() > 0) {
 				selectionSummary = selectionSummary + "   Ability: Sprint";
 			}
 			game->hGraphics->hTypewriter->setColor(1.0f, 0.0f, 0.0f);
 			break;
 		case V_PINK_G:
 			selectionSummary = kString("Pinky    Level: ") + currentSelection->getLevel();
-			if (difftime(currTime, currentSelection->getAbilityTriggered()) > currentSelection->getLevel() && currentSelection->getLevel() > 0) {
+			if (currTime - currentSelection->getAbilityTriggered() > currentSelection->getLevel() && currentSelection->getLevel() > 0) {
 				selectionSummary = selectionSummary + "   Ability: Jump";
 			}
 			game->hGraphics->hTypewriter->setColor(1.0f, 0.722f, 0.871f);
 			break;
 		case V_BLUE_G:
 			selectionSummary = kString("Inky     Level: ") + currentSelection->getLevel();
-			if (difftime(currTime, currentSelection->getAbilityTriggered()) > 2 * currentSelection->getLevel() && currentSelection->getLevel() > 0) {
+			if (currTime - currentSelection->getAbilityTriggered() > 2 * currentSelection->getLevel() && currentSelection->getLevel() > 0) {
 				selectionSummary = selectionSummary + "   Ability: Immunity";
 			}
 			game->hGraphics->hTypewriter->setColor(0.0f, 1.0f, 0.871f);
 			break;
 		case V_ORANGE_G:
 			selectionSummary = kString("Clyde    Level: ") + currentSelection->getLevel();
-			if (difftime(currTime, currentSelection->getAbilityTriggered()) > currentSelection->getLevel() && currentSelection->getLevel() > 0) {
+			if (currTime - currentSelection->getAbilityTriggered() > currentSelection->getLevel() && currentSelection->getLevel() > 0) {
 				selectionSummary = selectionSummary + "   Ability: Scatter";
 			}
 			game->hGraphics->hTypewriter->setColor(1.0f, 0.722f, 0.278f);
@@ -137,10 +159,10 @@ void renderInterface() {
 		game->hGraphics->hTypewriter->type(selectionSummary, game->hGraphics->getWidth(), game->hGraphics->getHeight());
 
 		// Render selection's ghost sprite
-		ghostTip->setX(sd1.value - 1.5f * ghostTip->getW().value);
-		ghostTip->setY(sd2.value + 0.25f * ghostTip->getH().value);
+		ghostTip->setX(sd1.value - 1.5f * ghostTip->getW());
+		ghostTip->setY(sd2.value + 0.25f * ghostTip->getH());
 		ghostTip->setType(currentSelection->getType());
-		ghostTip->render(game->hGraphics);
+		renderer->renderSprite(ghostTip, game->hGraphics);
 	}
 
 	// Render status message?
@@ -187,11 +209,12 @@ void extUpdate(float dt) {
 			case VS_LEVEL_START:
 				game->hSoundboard->playSong(mus1);
 				if (prevState == VS_DEFEAT) {
-					maze->newLevel(game->hGraphics, true);
+					maze->newLevel(true);
 				} else {
-					maze->newLevel(game->hGraphics);
+					maze->newLevel();
 				}
 				maze->pause();
+				recording->begin(maze, (float)timestep->getStepLength());
 				showHelpMsg = true;
 				helpMsgX.value = 0.8f;
 				helpMsg = getMessage(maze->getLevel());
@@ -200,6 +223,7 @@ void extUpdate(float dt) {
 			case VS_VICTORY:
 				game->hSoundboard->playSong(mus3);
 				maze->pause();
+				saveRecording();
 				showHelpMsg = false;
 				showStatusMsg = true;
 				statusMsg = "Victory!";
@@ -207,6 +231,7 @@ void extUpdate(float dt) {
 			case VS_DEFEAT:
 				game->hSoundboard->playSong(mus2);
 				maze->pause();
+				saveRecording();
 				showHelpMsg = true;
 				helpMsg = "You have been defeated! Pacman roams across your ancestral lands, consuming all in his path. Press 'spacebar' to start a new game!";
 				helpMsgX.value = 0.8f;
@@ -223,6 +248,7 @@ void extUpdate(float dt) {
 			case VS_LEVEL_PLAY:
 			default:
 				maze->unpause();
+				recording->addInput(MI_UNPAUSE);
 				showHelpMsg = true;
 				helpMsg = getMessage(maze->getLevel());
 				showStatusMsg = false;
@@ -255,7 +281,7 @@ void renderLeveling(aGraphics * context) {
 		// Blinky
 		ghostTip->setY(fromBottom.toPix(game->hGraphics->getHeight()) + 8.0f);
 		ghostTip->setType(V_RED_G);
-		ghostTip->render(context);
+		renderer->renderSprite(ghostTip, context);
 		int factor = (int)(100.0f * (1.0f - pow(0.5f, (float)(maze->blinky->getLevel() + 1))));
 		label = kString("Level up Sprint ('b'): ") + factor; label = label + "% speed bonus";
 		game->hGraphics->hTypewriter->setColor(1.0f, 0.0f, 0.0f);
@@ -268,7 +294,7 @@ void renderLeveling(aGraphics * context) {
 		// Pinky
 		ghostTip->setY(fromBottom.toPix(game->hGraphics->getHeight()) + 8.0f);
 		ghostTip->setType(V_PINK_G);
-		ghostTip->render(context);
+		renderer->renderSprite(ghostTip, context);
 		label = kString("Level up Jump ('p'): ") + (maze->pinky->getLevel()+1); label = label + " square distance";
 		game->hGraphics->hTypewriter->setColor(1.0f, 0.722f, 0.871f);
 		game->hGraphics->hTypewriter->moveCursor(fromLeft, fromBottom);
@@ -280,7 +306,7 @@ void renderLeveling(aGraphics * context) {
 		// Inky
 		ghostTip->setY(fromBottom.toPix(game->hGraphics->getHeight()) + 8.0f);
 		ghostTip->setType(V_BLUE_G);
-		ghostTip->render(context);
+		renderer->renderSprite(ghostTip, context);
 		label = kString("Level up Immunity ('i'): ") + (maze->inky->getLevel()+1); label = label + " second duration";
 		game->hGraphics->hTypewriter->setColor(0.0f, 1.0f, 0.871f);
 		game->hGraphics->hTypewriter->moveCursor(fromLeft, fromBottom);
@@ -292,7 +318,7 @@ void renderLeveling(aGraphics * context) {
 		// Clyde
 		ghostTip->setY(fromBottom.toPix(game->hGraphics->getHeight()) + 8.0f);
 		ghostTip->setType(V_ORANGE_G);
-		ghostTip->render(context);
+		renderer->renderSprite(ghostTip, context);
 		label = kString("Level up Scatter ('c'): ") + 2*(maze->clyde->getLevel()+1); label = label + " square radius";
 		game->hGraphics->hTypewriter->setColor(1.0f, 0.722f, 0.278f);
 		game->hGraphics->hTypewriter->moveCursor(fromLeft, fromBottom);
@@ -302,15 +328,28 @@ void renderLeveling(aGraphics * context) {
 }
 
 bool extRender() {
-	float dt = 0.01f;
+	// Run as many fixed-length ticks as the wall time since the last frame calls for, then draw between the last two
+	std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+	double elapsed = std::chrono::duration<double>(now - lastFrame).count();
+	lastFrame = now;
+	float dt = (float)timestep->getStepLength();
+	int steps = timestep->advance(elapsed);
+	for (int i = 0; i < steps; i++) {
+		maze->update(dt);
+		recording->step();
+		extUpdate(dt);
+	}
+	renderer->setAlpha(timestep->getAlpha());
+
+	// Drawing is recorded and played back on flush; the scene goes out before the interface text is drawn over it
 	if (currState == VS_LEVELING) {
 		renderLeveling(game->hGraphics);
 	} else {
-		maze->renderMaze(game->hGraphics);
+		renderer->renderMaze(maze, game->hGraphics);
 	}
+	renderer->flush(game->hGraphics);
 	renderInterface();
-	maze->update(dt);
-	extUpdate(dt);
+	renderer->flush(game->hGraphics);
 	return true;
 }
 
@@ -384,16 +423,21 @@ int main(int argc, char * argv[]) {
 		return 1;
 	}
 
-	// Load maze
+	// Load maze, centered in the window, and its renderer
 	maze = new vMaze();
-	maze->newLevel(game->hGraphics);
+	maze->setViewport(game->hGraphics->getWidth(), game->hGraphics->getHeight());
+	renderer = new vRenderer();
+	maze->newLevel();
 
 	// Load tip sprite
-	ghostTip = new vSprite(maze->getTextures());
+	ghostTip = new vSprite();
 	ghostTip->setState(SS_RIGHT2);
 
-	// Make sure maze and other misc content is rendered
+	// Make sure maze and other misc content is rendered; the simulation ticks at a fixed 100Hz whatever the frame rate
 	game->externalRender = extRender;
+	timestep = new vTimestep(0.01);
+	recording = new vMatchRecord();
+	lastFrame = std::chrono::steady_clock::now();
 
 	// Run game
 	prevState = VS_DEFEAT;
@@ -401,6 +445,7 @@ int main(int argc, char * argv[]) {
 	game->execute();
 
 	// Terminate game
+	delete recording;
 	game->terminate();
 	delete game;
 	return 0;
@@ -0,0 +1,153 @@
+/*	Brian Kirkpatrick
+	Pac-Man: Vengeance
+	Replay entry point
+	Begun Saturday, October 17th, 2026
+
+	Re-simulates a recorded match headless and renders it to video on the CPU, with no GPU or window:
+
+	  VengeanceReplay --match file.vmr [--out file.y4m|-] [--format y4m|rgba] [--fps n] [--width px] [--height px]
+	                  [--threads n] [--textures file.png]
+
+	The match is played back through vMaze::update at its recorded step length and in its recorded viewport, and a
+	frame is recorded every 1/fps seconds of match time; the camera frames it at the requested size. Frames are
+	rasterized by a pool of worker threads while the simulation runs ahead, and written in order by a separate thread,
+	so every core is kept busy.
+*/
+
+#include "vFramePipeline.h"
+#include "vImage.h"
+#include "vMatchRecord.h"
+#include "vMaze.h"
+#include "vRasterizer.h"
+#include "vSceneRecorder.h"
+#include "vVideoWriter.h"
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static void writeFrame(void * owner, vImage * frame, int) {
+	((vVideoWriter *)owner)->write(frame);
+}
+
+int main(int argc, char * argv[]) {
+	const char * matchPath = NULL;
+	const char * outPath = "replay.y4m";
+	const char * formatName = "y4m";
+	const char * texturePath = "resources/textures.png";
+	int fps = 50;
+	int width = 870;
+	int height = 675;
+	int numThreads = 0;
+
+	// Every option takes a value
+	for (int i = 1; i < argc; i++) {
+		if (i + 1 >= argc) {
+			fprintf(stderr, "Missing value for %s\n", argv[i]);
+			return 1;
+		}
+		if (strcmp(argv[i], "--match") == 0) {
+			matchPath = argv[++i];
+		} else if (strcmp(argv[i], "--out") == 0) {
+			outPath = argv[++i];
+		} else if (strcmp(argv[i], "--format") == 0) {
+			formatName = argv[++i];
+		} else if (strcmp(argv[i], "--fps") == 0) {
+			fps = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "--width") == 0) {
+			width = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "--height") == 0) {
+			height = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "--threads") == 0) {
+			numThreads = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "--textures") == 0) {
+			texturePath = argv[++i];
+		} else {
+			fprintf(stderr, "Unknown option %s\n", argv[i]);
+			return 1;
+		}
+	}
+	videoFormat format;
+	if (strcmp(formatName, "y4m") == 0) {
+		format = VF_Y4M;
+	} else if (strcmp(formatName, "rgba") == 0) {
+		format = VF_RGBA;
+	} else {
+		fprintf(stderr, "Unknown format %s\n", formatName);
+		return 1;
+	}
+	if (matchPath == NULL) {
+		fprintf(stderr, "No match given (--match file.vmr)\n");
+		return 1;
+	}
+	if (width <= 0 || height <= 0 || fps <= 0) {
+		fprintf(stderr, "Bad frame size %dx%d or rate %d\n", width, height, fps);
+		return 1;
+	}
+
+	vMatchRecord * record = new vMatchRecord();
+	if (!record->load(matchPath)) {
+		fprintf(stderr, "Can't read match %s\n", matchPath);
+		delete record;
+		return 1;
+	}
+	vImage * textureMap = new vImage();
+	if (!textureMap->loadPng(texturePath)) {
+		fprintf(stderr, "Can't read texture map %s\n", texturePath);
+		delete textureMap;
+		delete record;
+		return 1;
+	}
+	vVideoWriter * writer = new vVideoWriter();
+	if (!writer->open(outPath, width, height, fps, format)) {
+		fprintf(stderr, "Can't write %s\n", outPath);
+		delete writer;
+		delete textureMap;
+		delete record;
+		return 1;
+	}
+
+	// The level as it stood when recording began
+	vMaze * maze = new vMaze();
+	record->setup(maze);
+
+	// Workers each draw whole frames, so the rasterizer itself stays on one thread per frame
+	vRasterizer * rasterizer = new vRasterizer();
+	rasterizer->setNumThreads(1);
+	rasterizer->setTexture(ST_MAP, textureMap);
+	vFramePipeline * pipeline = new vFramePipeline(rasterizer, writeFrame, writer, numThreads);
+	vSceneRecorder * recorder = new vSceneRecorder();
+
+	// A frame at the start, then one every stepsPerFrame updates
+	float dt = record->getStepLength();
+	int stepsPerFrame = (int)floor(1.0 / (fps * (double)dt) + 0.5);
+	if (stepsPerFrame < 1) stepsPerFrame = 1;
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	int numSteps = record->getNumSteps();
+	for (int s = 0; s <= numSteps; s++) {
+		if (s % stepsPerFrame == 0) {
+			vRenderList * list = pipeline->acquire();
+			list->setSize(width, height);
+			recorder->recordMaze(list, maze);
+			pipeline->submit();
+		}
+		if (s == numSteps) break;
+		record->apply(maze, s);
+		maze->update(dt);
+	}
+	pipeline->finish();
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	double matchSeconds = numSteps * (double)dt;
+	fprintf(stderr, "Level %d, seed %llu: %d steps (%.1fs), %d frames in %.2fs, %.1f frames/s, %.1fx real time\n", record->getLevel(), (unsigned long long)record->getLevelSeed(), numSteps, matchSeconds, writer->getNumFrames(), seconds, seconds > 0.0 ? writer->getNumFrames() / seconds : 0.0, seconds > 0.0 ? matchSeconds / seconds : 0.0);
+
+	delete recorder;
+	delete pipeline;
+	delete rasterizer;
+	delete maze;
+	writer->close();
+	delete writer;
+	delete textureMap;
+	delete record;
+	return 0;
+}
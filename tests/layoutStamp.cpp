@@ -0,0 +1,33 @@
+/*	Brian Kirkpatrick
+	Pac-Man: Vengeance
+	Layout stamp test
+	Begun Saturday, October 17th, 2026
+
+	Plays a few levels for a while and checks that the maze's layout stamp holds still: nothing in a tick changes the
+	walls, so renderers should never have to rebake their wall layer mid-level.
+*/
+
+#include "vMaze.h"
+#include <stdio.h>
+
+int main() {
+	int failures = 0;
+	vMaze * maze = new vMaze();
+	maze->setPopulation(1, 4);
+	for (int level = 0; level < 8; level++) {
+		maze->setLevel(level);
+		maze->setLevelSeed((uint64_t)(42 + level));
+		maze->newLevel();
+		maze->unpause();
+		unsigned int stamp = maze->getLayoutStamp();
+		for (int i = 0; i < 500; i++) {
+			maze->update(0.01f);
+		}
+		if (maze->getLayoutStamp() != stamp) {
+			printf("Level %d: layout stamp moved from %u to %u without any wall changing\n", level + 1, stamp, maze->getLayoutStamp());
+			failures++;
+		}
+	}
+	delete maze;
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,60 @@
+/*	Brian Kirkpatrick
+	Pac-Man: Vengeance
+	Route table test
+	Begun Saturday, October 17th, 2026
+
+	Generates a few levels and follows the route table between every pair of squares: no hop may run into a wall, and
+	each route must reach its destination in no more steps than a fresh distance plot says it takes.
+*/
+
+#include "vMaze.h"
+#include "vRouteTable.h"
+#include <stdio.h>
+
+int main() {
+	int failures = 0;
+	vMaze * maze = new vMaze();
+	maze->setPopulation(1, 4);
+	for (int level = 0; level < 3; level++) {
+		maze->setLevel(level);
+		maze->setLevelSeed((uint64_t)(42 + level));
+		maze->newLevel();
+		vRouteTable * routes = maze->getRouteTable();
+		if (!routes->getIsBuilt()) {
+			printf("Level %d: route table was not built\n", level + 1);
+			failures++;
+			continue;
+		}
+		int w = maze->getNumW();
+		int h = maze->getNumH();
+		int * values = new int[w * h];
+		for (int dest = 0; dest < w * h && failures < 10; dest++) {
+			int destX = dest / h;
+			int destY = dest % h;
+			for (int i = 0; i < w * h; i++) {
+				values[i] = -1;
+			}
+			values[dest] = 0;
+			maze->aStarPlot(values, destX, destY);
+			for (int n = 0; n < w * h && failures < 10; n++) {
+				int x = n / h;
+				int y = n % h;
+				int steps = 0;
+				MazeDirection step;
+				while ((step = routes->getHop(x, y, destX, destY)) != MD_NONE && steps <= values[n]) {
+					if (maze->getWall(x, y, step)) break;
+					x += step == MD_RIGHT ? 1 : step == MD_LEFT ? -1 : 0;
+					y += step == MD_UP ? 1 : step == MD_DOWN ? -1 : 0;
+					steps++;
+				}
+				if (x != destX || y != destY || steps != values[n]) {
+					printf("Level %d: route from %d,%d to %d,%d stopped at %d,%d after %d steps (plot says %d)\n", level + 1, n / h, n % h, destX, destY, x, y, steps, values[n]);
+					failures++;
+				}
+			}
+		}
+		delete[] values;
+	}
+	delete maze;
+	return failures == 0 ? 0 : 1;
+}
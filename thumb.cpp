@@ -0,0 +1,115 @@
+/*	Brian Kirkpatrick
+	Pac-Man: Vengeance
+	Thumbnail entry point
+	Begun Saturday, October 17th, 2026
+
+	Generates a level headless and draws it with the software rasterizer, no GPU or window needed:
+
+	  VengeanceThumb [--seed n] [--level n] [--steps n] [--width px] [--height px] [--threads n]
+	                 [--pacmen n] [--ghosts n] [--textures file.png] [--out file.png]
+
+	The level is laid out from the seed exactly as the game and VengeanceBatch would lay it out, then simulated for
+	the given number of 10ms steps (ghosts unsteered) before the frame is taken.
+*/
+
+#include "vImage.h"
+#include "vMaze.h"
+#include "vRasterizer.h"
+#include "vRenderList.h"
+#include "vSceneRecorder.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+int main(int argc, char * argv[]) {
+	int level = 1;
+	int numSteps = 0;
+	int width = 870;
+	int height = 675;
+	int numThreads = 0;
+	int numPacmen = 1;
+	int numGhosts = 4;
+	const char * texturePath = "resources/textures.png";
+	const char * outPath = "thumb.png";
+	bool hasSeed = false;
+	unsigned long long seed = 0;
+
+	// Every option takes a value
+	for (int i = 1; i < argc; i++) {
+		if (i + 1 >= argc) {
+			fprintf(stderr, "Missing value for %s\n", argv[i]);
+			return 1;
+		}
+		if (strcmp(argv[i], "--seed") == 0) {
+			seed = strtoull(argv[++i], NULL, 10);
+			hasSeed = true;
+		} else if (strcmp(argv[i], "--level") == 0) {
+			level = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "--steps") == 0) {
+			numSteps = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "--width") == 0) {
+			width = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "--height") == 0) {
+			height = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "--threads") == 0) {
+			numThreads = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "--pacmen") == 0) {
+			numPacmen = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "--ghosts") == 0) {
+			numGhosts = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "--textures") == 0) {
+			texturePath = argv[++i];
+		} else if (strcmp(argv[i], "--out") == 0) {
+			outPath = argv[++i];
+		} else {
+			fprintf(stderr, "Unknown option %s\n", argv[i]);
+			return 1;
+		}
+	}
+	if (width <= 0 || height <= 0) {
+		fprintf(stderr, "Bad frame size %dx%d\n", width, height);
+		return 1;
+	}
+
+	vImage * textureMap = new vImage();
+	if (!textureMap->loadPng(texturePath)) {
+		fprintf(stderr, "Can't read texture map %s\n", texturePath);
+		delete textureMap;
+		return 1;
+	}
+
+	// Same setup as a batch level
+	vMaze * maze = new vMaze();
+	maze->setViewport(width, height);
+	maze->setPopulation(numPacmen, numGhosts);
+	maze->setLevel(level - 1);
+	if (hasSeed) maze->setLevelSeed((uint64_t)seed);
+	maze->newLevel();
+	for (int i = 0; i < numSteps; i++) {
+		maze->update(0.01f);
+	}
+
+	vRenderList * list = new vRenderList();
+	list->setSize(width, height);
+	vSceneRecorder * recorder = new vSceneRecorder();
+	recorder->recordMaze(list, maze);
+	vRasterizer * rasterizer = new vRasterizer();
+	rasterizer->setNumThreads(numThreads);
+	rasterizer->setTexture(ST_MAP, textureMap);
+	vImage * frame = new vImage();
+	rasterizer->render(list, frame);
+	bool saved = frame->savePng(outPath);
+	if (saved) {
+		printf("Level %d, seed %llu, %d commands: %s\n", level, (unsigned long long)maze->getLevelSeed(), list->getNumCommands(), outPath);
+	} else {
+		fprintf(stderr, "Can't write %s\n", outPath);
+	}
+
+	delete frame;
+	delete rasterizer;
+	delete recorder;
+	delete list;
+	delete maze;
+	delete textureMap;
+	return saved ? 0 : 1;
+}
@@ -3,8 +3,9 @@
 	Actor sprite class
 	Begun Monday, June 7th, 2010
 
-	The Actor class extends the sprite class, and encapsulates information and abilities specific to player objects
-	moving around in the world, such as ghosts and pacman
+	The Actor class encapsulates information and abilities specific to player objects moving around in the world,
+	such as ghosts and pacman. Actors keep the same interface as sprites, but hold no state of their own: each one
+	is a handle to a row of a vActorTable, where the state of every actor is stored field by field.
 */
 
 #include "vActor.h"
@@ -12,15 +13,11 @@
 
 // --- Constructors --- //
 
-vActor::vActor() : vSprite(NULL) {
-	// Initialize as not-selected, not-scared
-	isSelected = isScared = false;
+vActor::vActor(vActorTable * table) {
+	this->table = table;
+	slot = table->add();
 
-	// Starts out alive
-	isAlive = true;
-
-	// Start at level 0
-	level = 0;
+	// Rows start out alive and visible, not selected and not scared
 
 	// Default size is 16x16 px; align by center
 	setW(16.0f);
@@ -28,246 +25,249 @@ vActor::vActor() : vSprite(NULL) {
 	setAlignment(true);
 
 	// No initial AI or waypoint
-	mode = AI_NONE;
-	wayX = wayY = -1;
-
-	// Default velocity is globally defined
-	velocity = baseVelocity;
-	
-	// Initialize ability timestamp
-	time(&abilityTriggered);
+	setMode(AI_NONE);
 }
 
 vActor::~vActor() {
-	// Nothing to destroy
+	// The row stays with the table
+}
+
+// --- Private Methods --- //
+
+bool vActor::getFlag(ActorFlag f) {
+	return (table->flags[slot] & f) != 0;
+}
+
+void vActor::setFlag(ActorFlag f, bool s) {
+	if (s) {
+		table->flags[slot] |= (unsigned char)f;
+	} else {
+		table->flags[slot] &= (unsigned char)~f;
+	}
+}
+
+// --- Sprite Retrievers --- //
+
+float vActor::getX() {
+	return table->x[slot];
+}
+
+float vActor::getY() {
+	return table->y[slot];
+}
+
+float vActor::getW() {
+	return table->w[slot];
+}
+
+float vActor::getH() {
+	return table->h[slot];
+}
+
+float vActor::getPrevX() {
+	return table->prevX[slot];
+}
+
+float vActor::getPrevY() {
+	return table->prevY[slot];
+}
+
+float vActor::getVelX() {
+	return table->xVel[slot];
+}
+
+float vActor::getVelY() {
+	return table->yVel[slot];
+}
+
+bool vActor::getIsCentered() {
+	return getFlag(AF_CENTERED);
+}
+
+bool vActor::getIsVisible() {
+	return getFlag(AF_VISIBLE);
+}
+
+spriteState vActor::getState() {
+	return table->state[slot];
+}
+
+spriteType vActor::getType() {
+	return table->type[slot];
 }
 
 // --- Actor Retrievers --- //
 
+int vActor::getSlot() {
+	return slot;
+}
+
 float vActor::getVelocity() {
-	return velocity;
+	return table->velocity[slot];
 }
 
 bool vActor::getIsAlive() {
 	// Returns alive / not alive status
-	return isAlive;
+	return getFlag(AF_ALIVE);
 }
 
 bool vActor::getIsSelected() {
 	// Returns selection status
-	return isSelected;
+	return getFlag(AF_SELECTED);
 }
 
 bool vActor::getIsScared() {
 	// Returns scared status
-	return isScared;
+	return getFlag(AF_SCARED);
 }
 
 int vActor::getLevel() {
 	// Returns level of actor
-	return level;
+	return table->level[slot];
 }
 
 int vActor::getWayX() {
 	// Returns x coordinate of waypoint
-	return wayX;
+	return table->wayX[slot];
 }
 
 int vActor::getWayY() {
 	// Returns y coordinate of waypoint
-	return wayY;
+	return table->wayY[slot];
 }
 
 AiObjective vActor::getMode() {
 	// Returns AI mode
-	return mode;
+	return (AiObjective)table->mode[slot];
+}
+
+double vActor::getAbilityTriggered() {
+	return table->abilityTriggered[slot];
+}
+
+// --- Sprite Setters --- //
+
+void vActor::setAlignment(bool isCentered) {
+	setFlag(AF_CENTERED, isCentered);
+}
+
+void vActor::setState(spriteState s) {
+	table->state[slot] = s;
+	vSprite::heading(s, table->xVel[slot], table->yVel[slot]);
+}
+
+void vActor::setTimeSeed(float t) {
+	table->timeSeed[slot] = t;
+}
+
+void vActor::setVelX(float v) {
+	table->xVel[slot] = v;
 }
 
-time_t vActor::getAbilityTriggered() {
-	return abilityTriggered;
+void vActor::setVelY(float v) {
+	table->yVel[slot] = v;
+}
+
+void vActor::setVisible(bool v) {
+	setFlag(AF_VISIBLE, v);
+}
+
+void vActor::setX(float px) {
+	table->x[slot] = px;
+}
+
+void vActor::setY(float py) {
+	table->y[slot] = py;
+}
+
+void vActor::setW(float pw) {
+	table->w[slot] = pw;
+}
+
+void vActor::setH(float ph) {
+	table->h[slot] = ph;
 }
 
 // --- Actor Setters --- //
 
 void vActor::setVelocity(float v) {
-	velocity = v;
+	table->velocity[slot] = v;
 }
 
 void vActor::setLife(bool l) {
 	// Sets alive / not alive status
-	isAlive = l;
+	setFlag(AF_ALIVE, l);
 }
 
 void vActor::select() {
 	// Only select this actor if it is alive
-	if (isAlive) isSelected = true;
+	if (getIsAlive()) setFlag(AF_SELECTED, true);
 }
 
 void vActor::deselect() {
 	// Deselect actor
-	isSelected = false;
+	setFlag(AF_SELECTED, false);
 }
 
 void vActor::setScared(bool s) {
 	// Sets scared status
-	isScared = s;
+	setFlag(AF_SCARED, s);
 }
 
 void vActor::levelUp() {
 	// Increases actor level
-	level++;
+	table->level[slot]++;
 }
 
 void vActor::reset() {
-	level = 0;
+	table->level[slot] = 0;
 }
 
 void vActor::setWaypoint(int x, int y) {
 	// Sets 2d waypoint coordinate
-	wayX = x;
-	wayY = y;
+	table->wayX[slot] = x;
+	table->wayY[slot] = y;
 }
 
 void vActor::setMode(AiObjective m) {
 	// Sets AI mode
-	mode = m;
-}
-
-void vActor::setAbilityTriggered(time_t t) {
-	abilityTriggered = t;
+	table->mode[slot] = (unsigned char)m;
 }
 
-// --- Overridden Accessors --- //
-
-void vActor::setTexture(aTexture * t) {
-	// Set sprite (panel) texture
-	tex = t;
+void vActor::setAbilityTriggered(double t) {
+	table->abilityTriggered[slot] = t;
 }
 
 void vActor::setType(spriteType t) {
 	// Change type and adjust abilities, velocity accordingly
-	type = t;
+	table->type[slot] = t;
 	switch (t) {
 		case V_PACMAN:
-			velocity = baseVelocity;
+			setVelocity(baseVelocity);
 			break;
 		case V_RED_G:
-			velocity = 0.8f * baseVelocity;
+			setVelocity(0.8f * baseVelocity);
 			break;
 		case V_BLUE_G:
-			velocity = 0.8f * baseVelocity;
+			setVelocity(0.8f * baseVelocity);
 			break;
 		case V_ORANGE_G:
-			velocity = 0.8f * baseVelocity;
+			setVelocity(0.8f * baseVelocity);
 			break;
 		case V_PINK_G:
-			velocity = 0.8f * baseVelocity;
+			setVelocity(0.8f * baseVelocity);
 			break;
 		default:
-			velocity = 0.0f;
+			setVelocity(0.0f);
 			break;
 	}
 }
 
 // --- Methods --- //
 
-void vActor::render(aGraphics * context) {
-	// Override default panel / sprite rendering to draw selection box with same coordinates and override texture selection for 'scared' actors
-	// Draw sprite to screen surface, if alive and visible
-	if (isAlive && visible) {
-		// Calculate location, position
-		int screenWidth = context->getWidth();
-		int screenHeight = context->getHeight();
-		float centerX = x.unit == UNIT_PIX ? x.value / ((float)screenWidth) : x.value;
-		float centerY = y.unit == UNIT_PIX ? y.value / ((float)screenHeight) : y.value;
-		float left, right, bottom, top;
-		switch (w.align) {
-			case ALIGN_NEGATIVE:
-				left = centerX;
-				right = w.unit == UNIT_PIX ? centerX + w.value / (float)screenWidth : centerX + w.value;
-				break;
-			case ALIGN_POSITIVE:
-				left = w.unit == UNIT_PIX ? centerX - w.value / (float)screenWidth : centerX - w.value;
-				right = centerX;
-				break;
-			case ALIGN_MIDDLE:
-			default:
-				left = w.unit == UNIT_PIX ? centerX - 0.5f * w.value / (float)screenWidth : centerX - 0.5f * w.value;
-				right = w.unit == UNIT_PIX ? centerX + 0.5f * w.value / (float)screenWidth : centerX + 0.5f * w.value;
-				break;
-		}
-		switch (h.align) {
-			case ALIGN_NEGATIVE:
-				bottom = centerY;
-				top = h.unit == UNIT_PIX ? centerY + h.value / (float)screenHeight : centerY + h.value;
-				break;
-			case ALIGN_POSITIVE:
-				bottom = h.unit == UNIT_PIX ? centerY - h.value / (float)screenHeight : centerY - h.value;
-				top = centerY;
-				break;
-			case ALIGN_MIDDLE:
-			default:
-				bottom = h.unit == UNIT_PIX ? centerY - 0.5f * h.value / (float)screenHeight : centerY - 0.5f * h.value;
-				top = h.unit == UNIT_PIX ? centerY + 0.5f * h.value / (float)screenHeight : centerY + 0.5f * h.value;
-				break;
-		}
-
-		// Draw 2d quad
-		bgColor->setAll();
-
-		// Draw textured panel
-		tex->bind();
-		int currType = isScared ? (int)V_SCARED_G : (int)type;
-		float texLeft = spriteTex * (float)state;
-		float texTop = spriteTex * (float)currType;
-		float texRight = texLeft + spriteTex;
-		float texBottom = texTop + spriteTex;
-		glBegin(GL_QUADS); {
-			glTexCoord2f(texLeft, texBottom);
-			glVertex2f(left, bottom);
-			glTexCoord2f(texRight, texBottom);
-			glVertex2f(right, bottom);
-			glTexCoord2f(texRight, texTop);
-			glVertex2f(right, top);
-			glTexCoord2f(texLeft, texTop);
-			glVertex2f(left, top);
-		} glEnd();
-		tex->unbind();
-
-		// Render selection box, if selected
-		if (isSelected) {
-			switch (type) {
-				case V_RED_G:
-					glColor3f(1.0f, 0.0f, 0.0f);
-					break;
-				case V_BLUE_G:
-					glColor3f(0.0f, 1.0f, 0.871f);
-					break;
-				case V_ORANGE_G:
-					glColor3f(1.0f, 0.722f, 0.278f);
-					break;
-				case V_PINK_G:
-					glColor3f(1.0f, 0.722f, 0.871f);
-					break;
-				default:
-					glColor3f(0.0f, 0.0f, 0.0f);
-					break;
-			}
-			glBegin(GL_LINE_STRIP); {
-				float margin = 0.005f;
-				glVertex2f(left-margin, bottom-margin);
-				glVertex2f(right+margin, bottom-margin);
-				glVertex2f(right+margin, top+margin);
-				glVertex2f(left-margin, top+margin);
-				glVertex2f(left-margin, bottom-margin);
-			} glEnd();
-		}
-	}
+void vActor::moveToPix(int px, int py) {
+	table->x[slot] = (float)px;
+	table->y[slot] = (float)py;
+	table->prevX[slot] = table->x[slot];
+	table->prevY[slot] = table->y[slot];
 }
-
-void vActor::update(float dt) {
-	// Only update if actor is alive
-	if (isAlive) {
-		vSprite::update(dt);
-	}
-}
\ No newline at end of file
@@ -3,39 +3,49 @@
 	Actor sprite class
 	Begun Monday, June 7th, 2010
 
-	The Actor class extends the sprite class, and encapsulates information and abilities specific to player objects
-	moving around in the world, such as ghosts and pacman
+	The Actor class encapsulates information and abilities specific to player objects moving around in the world,
+	such as ghosts and pacman. Actors keep the same interface as sprites, but hold no state of their own: each one
+	is a handle to a row of a vActorTable, where the state of every actor is stored field by field.
 */
 
 #ifndef VENGEANCE_ACTOR_H
 #define VENGEANCE_ACTOR_H
 
 #include "vSprite.h"
-#include "libArtemis.h"
-#include <time.h>
+#include "vActorTable.h"
 
 // Several AI modes exist
 enum AiObjective { AI_NONE, AI_AVOID, AI_HOMICIDAL, AI_GREEDY, AI_RANDOM };
 
-class vActor : public vSprite {
+class vActor {
 private:
 	// Data
-	float velocity;
-	bool isAlive;
-	bool isSelected;
-	bool isScared;
-	int level;
-	int wayX;
-	int wayY;
-	AiObjective mode;
-	time_t abilityTriggered;
+	vActorTable * table;
+	int slot;
+	bool getFlag(ActorFlag f);
+	void setFlag(ActorFlag f, bool s);
 protected:
 public:
 	// Constructors
-	vActor();
+	vActor(vActorTable * table);	// Adds a row to the table for this actor
 	~vActor();
 
+	// Sprite retrievers
+	float getX();
+	float getY();
+	float getW();
+	float getH();
+	float getPrevX();
+	float getPrevY();
+	float getVelX();
+	float getVelY();
+	bool getIsCentered();
+	bool getIsVisible();
+	spriteState getState();
+	spriteType getType();
+
 	// Actor retrievers
+	int getSlot();
 	float getVelocity();
 	bool getIsAlive();
 	bool getIsSelected();
@@ -44,7 +54,19 @@ public:
 	int getWayX();
 	int getWayY();
 	AiObjective getMode();
-	time_t getAbilityTriggered();
+	double getAbilityTriggered();
+
+	// Sprite setters
+	void setAlignment(bool isCentered);
+	void setState(spriteState s);
+	void setTimeSeed(float t);
+	void setVelX(float v);
+	void setVelY(float v);
+	void setVisible(bool v);
+	void setX(float px);
+	void setY(float py);
+	void setW(float pw);
+	void setH(float ph);
 
 	// Actor setters
 	void setVelocity(float v);
@@ -56,15 +78,11 @@ public:
 	void reset();
 	void setWaypoint(int x, int y);
 	void setMode(AiObjective m);
-	void setAbilityTriggered(time_t t);
-
-	// Overridden accessors
-	void setTexture(aTexture * t);
+	void setAbilityTriggered(double t);
 	void setType(spriteType t);
 
 	// Methods
-	void render(aGraphics * context);
-	void update(float dt);
+	void moveToPix(int px, int py);	// Jumps straight there, with no interpolation from the old position
 };
 
-#endif
\ No newline at end of file
+#endif
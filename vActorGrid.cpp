@@ -0,0 +1,138 @@
+/*	Brian Kirkpatrick
+	Pac-Man: Vengeance
+	Actor grid class
+	Begun Saturday, October 17th, 2026
+
+	The actor grid is an occupancy index over the squares of a maze: each square heads a linked list of the actors
+	(by actor table slot) standing in it. Actors are moved between lists only when they change squares, so keeping
+	the index current costs nothing for actors that stay put. Collision checks only look at the lists of the squares
+	an actor overlaps, and nearest-actor queries walk outwards from a square in order of maze distance (through open
+	walls), stopping as soon as enough actors are found.
+*/
+
+#include "vActorGrid.h"
+
+// --- Constructors --- //
+
+vActorGrid::vActorGrid() {
+	numW = 0;
+	numH = 0;
+	numPlaced = 0;
+	stamp = 0;
+}
+
+vActorGrid::~vActorGrid() {
+	// Lists are freed with the grid
+}
+
+// --- Accessors --- //
+
+int vActorGrid::getCell(int slot) {
+	return cells[slot];
+}
+
+int vActorGrid::getCount() {
+	return numPlaced;
+}
+
+int vActorGrid::getFirst(int x, int y) {
+	if (x < 0 || x >= numW || y < 0 || y >= numH) return -1;
+	return heads[x * numH + y];
+}
+
+int vActorGrid::getNext(int slot) {
+	return next[slot];
+}
+
+// --- Methods --- //
+
+int vActorGrid::nearest(vMaze * maze, int x, int y, int k, int * found) {
+	// Breadth-first from x,y; squares are visited in order of maze distance, so the first k actors met are the nearest
+	if (x < 0 || x >= numW || y < 0 || y >= numH || k <= 0 || numPlaced == 0) return 0;
+	int numFound = 0;
+	if (numPlaced == 1) {
+		// Nothing to compare; the lone actor is the nearest wherever it is
+		for (size_t i = 0; i < cells.size(); i++) {
+			if (cells[i] != -1) {
+				found[0] = (int)i;
+				return 1;
+			}
+		}
+	}
+	stamp++;
+	if (stamp == 0) {
+		// Wrapped; old marks could pass for new ones
+		for (size_t i = 0; i < stamps.size(); i++) stamps[i] = -1;
+		stamp = 1;
+	}
+	int qHead = 0;
+	int qTail = 0;
+	queue[qTail++] = x * numH + y;
+	stamps[x * numH + y] = stamp;
+	while (qHead < qTail) {
+		int c = queue[qHead++];
+		for (int s = heads[c]; s != -1; s = next[s]) {
+			found[numFound++] = s;
+			if (numFound == k) return numFound;
+		}
+		int cx = c / numH;
+		int cy = c % numH;
+		if (cy < numH - 1 && !maze->getWall(cx, cy, MD_UP) && stamps[c + 1] != stamp) {
+			stamps[c + 1] = stamp;
+			queue[qTail++] = c + 1;
+		}
+		if (cx > 0 && !maze->getWall(cx, cy, MD_LEFT) && stamps[c - numH] != stamp) {
+			stamps[c - numH] = stamp;
+			queue[qTail++] = c - numH;
+		}
+		if (cy > 0 && !maze->getWall(cx, cy, MD_DOWN) && stamps[c - 1] != stamp) {
+			stamps[c - 1] = stamp;
+			queue[qTail++] = c - 1;
+		}
+		if (cx < numW - 1 && !maze->getWall(cx, cy, MD_RIGHT) && stamps[c + numH] != stamp) {
+			stamps[c + numH] = stamp;
+			queue[qTail++] = c + numH;
+		}
+	}
+	return numFound;
+}
+
+void vActorGrid::place(int slot, int x, int y) {
+	int c = x * numH + y;
+	if (cells[slot] == c) return;
+	remove(slot);
+	numPlaced++;
+	cells[slot] = c;
+	prev[slot] = -1;
+	next[slot] = heads[c];
+	if (heads[c] != -1) prev[heads[c]] = slot;
+	heads[c] = slot;
+}
+
+void vActorGrid::remove(int slot) {
+	int c = cells[slot];
+	if (c == -1) return;
+	if (prev[slot] != -1) {
+		next[prev[slot]] = next[slot];
+	} else {
+		heads[c] = next[slot];
+	}
+	if (next[slot] != -1) prev[next[slot]] = prev[slot];
+	numPlaced--;
+	cells[slot] = -1;
+	prev[slot] = -1;
+	next[slot] = -1;
+}
+
+void vActorGrid::resize(int w, int h, int numSlots) {
+	numW = w > 0 ? w : 0;
+	numH = h > 0 ? h : 0;
+	heads.assign(numW * numH, -1);
+	stamps.assign(numW * numH, 0);
+	queue.assign(numW * numH, 0);
+	stamp = 0;
+	numPlaced = 0;
+	next.assign(numSlots, -1);
+	prev.assign(numSlots, -1);
+	cells.assign(numSlots, -1);
+}
@@ -0,0 +1,50 @@
+/*	Brian Kirkpatrick
+	Pac-Man: Vengeance
+	Actor grid class
+	Begun Saturday, October 17th, 2026
+
+	The actor grid is an occupancy index over the squares of a maze: each square heads a linked list of the actors
+	(by actor table slot) standing in it. Actors are moved between lists only when they change squares, so keeping
+	the index current costs nothing for actors that stay put. Collision checks only look at the lists of the squares
+	an actor overlaps, and nearest-actor queries walk outwards from a square in order of maze distance (through open
+	walls), stopping as soon as enough actors are found.
+*/
+
+#ifndef VENGEANCE_ACTOR_GRID_H
+#define VENGEANCE_ACTOR_GRID_H
+
+#include "vMaze.h"
+#include <vector>
+
+class vActorGrid {
+private:
+	// Data
+	int numW, numH;
+	int numPlaced;
+	int stamp;					// Marks squares visited by the current query
+	std::vector<int> heads;		// numW*numH; first slot in each square, or -1
+	std::vector<int> next;		// Per slot; next slot in the same square, or -1
+	std::vector<int> prev;		// Per slot; previous slot in the same square, or -1
+	std::vector<int> cells;		// Per slot; square index, or -1 when not in the grid
+	std::vector<int> stamps;	// numW*numH
+	std::vector<int> queue;		// Squares waiting to be visited, numW*numH long
+protected:
+public:
+	// Constructors
+	vActorGrid();
+	~vActorGrid();
+
+	// Accessors
+	int getCell(int slot);		// x * numH + y, or -1
+	int getCount();				// Slots currently in the grid
+	int getFirst(int x, int y);	// -1 if empty
+	int getNext(int slot);		// -1 at the end of the square's list
+
+	// Methods
+	int nearest(vMaze * maze, int x, int y, int k, int * found);	// Up to k slots, nearest first by maze distance; returns count
+	void place(int slot, int x, int y);	// Adds the slot, or moves it if it is in another square
+	void remove(int slot);
+	void resize(int w, int h, int numSlots);	// Empties the grid
+};
+
+#endif
@@ -0,0 +1,115 @@
+/*	Brian Kirkpatrick
+	Pac-Man: Vengeance
+	Actor table class
+	Begun Saturday, October 17th, 2026
+
+	The actor table keeps the simulation state of every actor in the maze as a structure of arrays: one contiguous
+	array per field (position, velocity, cell, mode, flags, level...), indexed by the actor's slot. Per-tick passes
+	such as integration and animation run straight down those arrays over however many actors there are; vActor is
+	only a handle (table and slot) that reads and writes one row of it.
+*/
+
+#include "vActorTable.h"
+
+// --- Constructors --- //
+
+vActorTable::vActorTable() {
+}
+
+vActorTable::~vActorTable() {
+	// Arrays are freed with the table
+}
+
+// --- Accessors --- //
+
+int vActorTable::getSize() {
+	return (int)x.size();
+}
+
+// --- Methods --- //
+
+int vActorTable::add() {
+	// Same defaults as a freshly constructed sprite
+	x.push_back(0.0f);
+	y.push_back(0.0f);
+	prevX.push_back(0.0f);
+	prevY.push_back(0.0f);
+	w.push_back(spriteDim);
+	h.push_back(spriteDim);
+	xVel.push_back(0.0f);
+	yVel.push_back(0.0f);
+	velocity.push_back(baseVelocity);
+	timeSeed.push_back(0.0f);
+	cellX.push_back(-1);
+	cellY.push_back(-1);
+	level.push_back(0);
+	wayX.push_back(-1);
+	wayY.push_back(-1);
+	flags.push_back((unsigned char)(AF_ALIVE | AF_VISIBLE));
+	mode.push_back(0);
+	state.push_back(SS_NA);
+	type.push_back(V_PACMAN);
+	abilityTriggered.push_back(0.0);
+	abilityTimer.push_back(-1);
+	return getSize() - 1;
+}
+
+void vActorTable::clear() {
+	x.clear();
+	y.clear();
+	prevX.clear();
+	prevY.clear();
+	w.clear();
+	h.clear();
+	xVel.clear();
+	yVel.clear();
+	velocity.clear();
+	timeSeed.clear();
+	cellX.clear();
+	cellY.clear();
+	level.clear();
+	wayX.clear();
+	wayY.clear();
+	flags.clear();
+	mode.clear();
+	state.clear();
+	type.clear();
+	abilityTriggered.clear();
+	abilityTimer.clear();
+}
+
+void vActorTable::animate(float dt) {
+	int n = getSize();
+	for (int i = 0; i < n; i++) {
+		if (!(flags[i] & AF_ALIVE)) continue;
+		timeSeed[i] += dt;
+		while (timeSeed[i] >= animationPeriod) {
+			timeSeed[i] -= animationPeriod;
+		}
+		state[i] = vSprite::animate(state[i], timeSeed[i]);
+	}
+}
+
+void vActorTable::integrate(float dt) {
+	// Branch-free, so the loop vectorizes; dead actors take a zero-length step
+	int n = getSize();
+	if (n == 0) return;
+	float * px = &x[0];
+	float * py = &y[0];
+	const float * vx = &xVel[0];
+	const float * vy = &yVel[0];
+	const unsigned char * f = &flags[0];
+	for (int i = 0; i < n; i++) {
+		float step = (f[i] & AF_ALIVE) ? dt : 0.0f;
+		px[i] += vx[i] * step;
+		py[i] += vy[i] * step;
+	}
+}
+
+void vActorTable::savePositions() {
+	int n = getSize();
+	for (int i = 0; i < n; i++) {
+		prevX[i] = x[i];
+		prevY[i] = y[i];
+	}
+}
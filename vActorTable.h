@@ -0,0 +1,57 @@
+/*	Brian Kirkpatrick
+	Pac-Man: Vengeance
+	Actor table class
+	Begun Saturday, October 17th, 2026
+
+	The actor table keeps the simulation state of every actor in the maze as a structure of arrays: one contiguous
+	array per field (position, velocity, cell, mode, flags, level...), indexed by the actor's slot. Per-tick passes
+	such as integration and animation run straight down those arrays over however many actors there are; vActor is
+	only a handle (table and slot) that reads and writes one row of it.
+*/
+
+#ifndef VENGEANCE_ACTOR_TABLE_H
+#define VENGEANCE_ACTOR_TABLE_H
+
+#include "vSprite.h"
+#include <vector>
+
+// Per-actor boolean state, packed into one byte
+enum ActorFlag { AF_ALIVE = 1, AF_SELECTED = 2, AF_SCARED = 4, AF_VISIBLE = 8, AF_CENTERED = 16 };
+
+class vActorTable {
+private:
+protected:
+public:
+	// Data: public so passes can run over the arrays directly; every array is getSize() long
+	std::vector<float> x, y;			// Pixels
+	std::vector<float> prevX, prevY;	// Position as of the previous simulation tick, for interpolated drawing
+	std::vector<float> w, h;			// Pixels
+	std::vector<float> xVel, yVel;		// Pixels / second
+	std::vector<float> velocity;		// Speed the actor moves at when not blocked, pixels / second
+	std::vector<float> timeSeed;		// Position within the animation cycle, seconds
+	std::vector<int> cellX, cellY;		// Maze square the actor was in at the start of the tick
+	std::vector<int> level;
+	std::vector<int> wayX, wayY;
+	std::vector<unsigned char> flags;	// ActorFlag bits
+	std::vector<unsigned char> mode;	// AiObjective
+	std::vector<spriteState> state;
+	std::vector<spriteType> type;
+	std::vector<double> abilityTriggered;	// Maze clock time the ability was last used, in seconds
+	std::vector<int> abilityTimer;			// Pending timer handle ending the ability, or -1
+
+	// Constructors
+	vActorTable();
+	~vActorTable();
+
+	// Accessors
+	int getSize();
+
+	// Methods
+	int add();						// Appends a row with sprite defaults; returns its slot
+	void clear();					// Drops every row; handles into the table must go too
+	void animate(float dt);			// Advances animation cycles of living actors
+	void integrate(float dt);		// Moves living actors along their velocities
+	void savePositions();			// Marks the start of a simulation tick for every actor
+};
+
+#endif
@@ -0,0 +1,245 @@
+/*	Brian Kirkpatrick
+	Pac-Man: Vengeance
+	Batch runner class
+	Begun Saturday, October 17th, 2026
+
+	The batch runner plays many independent levels headless, across all cores, and tallies the results. Every level
+	gets its own vMaze and its own seed; ghosts are steered by a pluggable controller and pacman by the maze's
+	built-in AI. Levels are dealt out to per-thread work queues, and threads that run dry steal from the others, since
+	bigger (later) levels take much longer to play out than small ones.
+*/
+
+#include "vBatchRunner.h"
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <stdio.h>
+#include <thread>
+#include <vector>
+
+// One work queue per thread: the owner takes from the back, thieves take from the front
+struct workQueue {
+	std::mutex lock;
+	std::deque<int> tasks;
+};
+
+static bool takeTask(workQueue * queue, bool fromFront, int * task) {
+	std::lock_guard<std::mutex> guard(queue->lock);
+	if (queue->tasks.empty()) return false;
+	if (fromFront) {
+		*task = queue->tasks.front();
+		queue->tasks.pop_front();
+	} else {
+		*task = queue->tasks.back();
+		queue->tasks.pop_back();
+	}
+	return true;
+}
+
+// --- batchStats --- //
+
+batchStats::batchStats() {
+	levelsPlayed = 0;
+	wins = 0;
+	losses = 0;
+	draws = 0;
+	pointsSaved = 0;
+	pointsEaten = 0;
+	steps = 0;
+	seconds = 0.0;
+}
+
+void batchStats::add(const batchStats & other) {
+	levelsPlayed += other.levelsPlayed;
+	wins += other.wins;
+	losses += other.losses;
+	draws += other.draws;
+	pointsSaved += other.pointsSaved;
+	pointsEaten += other.pointsEaten;
+	steps += other.steps;
+}
+
+// --- Constructors --- //
+
+vBatchRunner::vBatchRunner(vGhostController * c) {
+	controller = c;
+	numThreads = 0;
+	maxSteps = 6000;
+	numPacmen = 1;
+	numGhosts = 4;
+	stepLength = 0.01f;
+	Dice die = Dice();
+	seed = die.next();
+}
+
+vBatchRunner::~vBatchRunner() {
+	// Controller belongs to the caller
+}
+
+// --- Private Methods --- //
+
+void vBatchRunner::playLevel(int index, int level, uint64_t levelSeed, batchStats * stats) {
+	// Plays one level to completion (or the step limit) in a maze of its own
+	vMaze * maze = new vMaze();
+	maze->setPopulation(numPacmen, numGhosts);
+	maze->setLevel(level - 1);
+	maze->setLevelSeed(levelSeed);
+	maze->newLevel();
+	vMatchRecord * record = NULL;
+	if (!recordPrefix.empty()) {
+		record = new vMatchRecord();
+		record->begin(maze, stepLength);
+	}
+	int startPoints = maze->getCurrentPointsTotal();
+	int step = 0;
+	bool isOver = false;
+	while (!isOver && step < maxSteps) {
+		steerGhosts(maze, record);
+		maze->update(stepLength);
+		if (record != NULL) record->step();
+		step++;
+		if (maze->getNumAlivePacmen() == 0) {
+			stats->wins++;
+			stats->pointsSaved += maze->getCurrentPointsTotal();
+			isOver = true;
+		} else if (maze->getNumAliveGhosts() == 0) {
+			stats->losses++;
+			isOver = true;
+		}
+	}
+	if (!isOver) stats->draws++;
+	stats->levelsPlayed++;
+	stats->pointsEaten += startPoints - maze->getCurrentPointsTotal();
+	stats->steps += step;
+	if (record != NULL) {
+		char filename[1024];
+		snprintf(filename, sizeof(filename), "%s-%d.vmr", recordPrefix.c_str(), index);
+		record->save(filename);
+		delete record;
+	}
+	delete maze;
+}
+
+void vBatchRunner::steerGhosts(vMaze * maze, vMatchRecord * record) {
+	// Ghosts only take new orders near the middle of a square, where turnActor will accept a turn
+	float window = 0.25f * maze->getSquareDim();
+	for (int i = 0; i < maze->getNumGhosts(); i++) {
+		vActor * ghost = maze->getGhost(i);
+		if (!ghost->getIsAlive()) continue;
+		int mx = maze->screenX2mazeX((int)(ghost->getX()));
+		int my = maze->screenY2mazeY((int)(ghost->getY()));
+		float offX = ghost->getX() - (float)maze->mazeX2screenX(mx);
+		float offY = ghost->getY() - (float)maze->mazeY2screenY(my);
+		if (offX > window || offX < -window || offY > window || offY < -window) continue;
+		MazeDirection direction = controller->steer(maze, ghost);
+		if (direction != MD_NONE) {
+			maze->turnActor(ghost, direction);
+			if (record != NULL) record->addInput(MI_TURN, ghost->getSlot(), direction);
+		}
+	}
+}
+
+// --- Accessors --- //
+
+int vBatchRunner::getMaxSteps() {
+	return maxSteps;
+}
+
+int vBatchRunner::getNumThreads() {
+	return numThreads;
+}
+
+float vBatchRunner::getStepLength() {
+	return stepLength;
+}
+
+uint64_t vBatchRunner::getSeed() {
+	return seed;
+}
+
+int vBatchRunner::getNumGhosts() {
+	return numGhosts;
+}
+
+int vBatchRunner::getNumPacmen() {
+	return numPacmen;
+}
+
+void vBatchRunner::setPopulation(int p, int g) {
+	// Same limits as the maze's
+	numPacmen = p > 1 ? p : 1;
+	numGhosts = g > 4 ? g : 4;
+}
+
+void vBatchRunner::setMaxSteps(int s) {
+	maxSteps = s > 0 ? s : 1;
+}
+
+void vBatchRunner::setNumThreads(int n) {
+	numThreads = n > 0 ? n : 0;
+}
+
+void vBatchRunner::setRecordPrefix(const char * prefix) {
+	recordPrefix = prefix != NULL ? prefix : "";
+}
+
+void vBatchRunner::setSeed(uint64_t s) {
+	seed = s;
+}
+
+void vBatchRunner::setStepLength(float dt) {
+	stepLength = dt > 0.0f ? dt : 0.01f;
+}
+
+// --- Methods --- //
+
+batchStats vBatchRunner::run(int numLevels, int firstLevel, int lastLevel) {
+	batchStats total;
+	if (numLevels <= 0 || controller == NULL) return total;
+	if (firstLevel < 1) firstLevel = 1;
+	if (lastLevel < firstLevel) lastLevel = firstLevel;
+	int span = lastLevel - firstLevel + 1;
+	int threads = numThreads;
+	if (threads == 0) threads = (int)std::thread::hardware_concurrency();
+	if (threads < 1) threads = 1;
+	if (threads > numLevels) threads = numLevels;
+
+	// Deal the levels out round-robin, so each queue starts with a similar mix of sizes
+	std::vector<workQueue> queues(threads);
+	for (int i = 0; i < numLevels; i++) {
+		queues[i % threads].tasks.push_back(i);
+	}
+
+	std::mutex totalLock;
+	auto worker = [this, &queues, &total, &totalLock, threads, firstLevel, span](int id) {
+		batchStats local;
+		int task;
+		while (true) {
+			// Own queue first; then steal, starting from the next thread over. No new work is ever queued, so one
+			// empty pass over every queue means the batch is done.
+			bool found = takeTask(&queues[id], false, &task);
+			for (int k = 1; !found && k < threads; k++) {
+				found = takeTask(&queues[(id + k) % threads], true, &task);
+			}
+			if (!found) break;
+			playLevel(task, firstLevel + task % span, seed + (uint64_t)task, &local);
+		}
+		std::lock_guard<std::mutex> guard(totalLock);
+		total.add(local);
+	};
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	if (threads == 1) {
+		worker(0);
+	} else {
+		std::vector<std::thread> pool;
+		for (int t = 0; t < threads; t++) {
+			pool.push_back(std::thread(worker, t));
+		}
+		for (int t = 0; t < threads; t++) {
+			pool[t].join();
+		}
+	}
+	total.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	return total;
+}
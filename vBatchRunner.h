@@ -0,0 +1,73 @@
+/*	Brian Kirkpatrick
+	Pac-Man: Vengeance
+	Batch runner class
+	Begun Saturday, October 17th, 2026
+
+	The batch runner plays many independent levels headless, across all cores, and tallies the results. Every level
+	gets its own vMaze and its own seed; ghosts are steered by a pluggable controller and pacman by the maze's
+	built-in AI. Levels are dealt out to per-thread work queues, and threads that run dry steal from the others, since
+	bigger (later) levels take much longer to play out than small ones.
+*/
+
+#ifndef VENGEANCE_BATCH_RUNNER_H
+#define VENGEANCE_BATCH_RUNNER_H
+
+#include "vMaze.h"
+#include "vGhostController.h"
+#include "vMatchRecord.h"
+#include <string>
+
+struct batchStats {
+	int levelsPlayed;
+	int wins;				// Every pacman was eaten
+	int losses;				// Every ghost was eaten
+	int draws;				// Step limit reached first
+	long long pointsSaved;	// Points left uneaten in levels that were won
+	long long pointsEaten;	// Points eaten by pacman, over all levels
+	long long steps;		// Simulation steps, over all levels
+	double seconds;			// Wall-clock time for the whole batch
+
+	// Methods
+	batchStats();
+	void add(const batchStats & other);	// Sums counts; seconds are left alone
+};
+
+class vBatchRunner {
+private:
+	// Data
+	int numThreads;
+	int maxSteps;
+	int numPacmen, numGhosts;	// Population of every maze
+	float stepLength;
+	uint64_t seed;		// Level i of a batch is played from seed+i
+	std::string recordPrefix;	// Level i is saved as prefix-i.vmr, if set
+	vGhostController * controller;
+
+	// Methods
+	void playLevel(int index, int level, uint64_t levelSeed, batchStats * stats);
+	void steerGhosts(vMaze * maze, vMatchRecord * record);
+protected:
+public:
+	// Constructors
+	vBatchRunner(vGhostController * c);
+	~vBatchRunner();
+
+	// Accessors
+	int getMaxSteps();
+	int getNumGhosts();
+	int getNumPacmen();
+	int getNumThreads();
+	float getStepLength();
+	uint64_t getSeed();
+	void setMaxSteps(int s);
+	void setNumThreads(int n);			// 0 uses every hardware thread
+	void setRecordPrefix(const char * prefix);	// Saves every level's match for replay; NULL or "" stops
+	void setPopulation(int p, int g);	// Pacmen and ghosts per maze; 1 and 4 by default
+	void setSeed(uint64_t s);
+	void setStepLength(float dt);		// Seconds of game time per step
+
+	// Methods
+	batchStats run(int numLevels, int firstLevel, int lastLevel);	// Level numbers cycle from first to last
+};
+
+#endif
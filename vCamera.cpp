@@ -0,0 +1,110 @@
+/*	Brian Kirkpatrick
+	Pac-Man: Vengeance
+	Camera class
+	Begun Saturday, October 17th, 2026
+
+	The camera decides which part of the maze is on screen. Actors, walls and items are laid out in maze pixels (see
+	vMaze::mazeX2screenX); a maze that fits the view is centered in it, while a larger one is panned to keep the
+	selected ghost in the middle, stopping at the maze's edges. The view need not be the maze's viewport, so a match
+	simulated in one window can be drawn at any size. The camera also answers which squares and rectangles can be
+	seen, so recorders only submit what lands on screen.
+*/
+
+#include "vCamera.h"
+#include <math.h>
+
+// --- Constructors --- //
+
+vCamera::vCamera() {
+	offsetX = 0.0f;
+	offsetY = 0.0f;
+	viewW = 870;
+	viewH = 675;
+}
+
+vCamera::~vCamera() {
+	// Nothing to destroy
+}
+
+// --- Accessors --- //
+
+float vCamera::getOffsetX() {
+	return offsetX;
+}
+
+float vCamera::getOffsetY() {
+	return offsetY;
+}
+
+int vCamera::getViewW() {
+	return viewW;
+}
+
+int vCamera::getViewH() {
+	return viewH;
+}
+
+void vCamera::setOffset(float x, float y) {
+	offsetX = floorf(x + 0.5f);
+	offsetY = floorf(y + 0.5f);
+}
+
+void vCamera::setView(int w, int h) {
+	viewW = w;
+	viewH = h;
+}
+
+// --- Methods --- //
+
+void vCamera::follow(vMaze * maze, float alpha) {
+	// Along each axis, a maze that fits is centered in the view the way vMaze::resize centers it in its own viewport,
+	// so the two agree when they are the same size; otherwise the selection is centered, unless that would show past
+	// the outer walls. The extent runs over the wall segments, half a square beyond the outer squares.
+	float squareDim = maze->getSquareDim();
+	float left = (float)maze->mazeX2screenX(0) - squareDim;
+	float right = (float)maze->mazeX2screenX(maze->getNumW());
+	float bottom = (float)maze->mazeY2screenY(0) - squareDim;
+	float top = (float)maze->mazeY2screenY(maze->getNumH());
+	float targetX = 0.5f * (left + right);
+	float targetY = 0.5f * (bottom + top);
+	vActor * selection = maze->findSelection();
+	if (selection != NULL && selection->getIsAlive()) {
+		targetX = selection->getPrevX() + alpha * (selection->getX() - selection->getPrevX());
+		targetY = selection->getPrevY() + alpha * (selection->getY() - selection->getPrevY());
+	}
+
+	int originX = maze->mazeX2screenX(0) - (int)(0.5f * squareDim);
+	int originY = maze->mazeY2screenY(0) - (int)(0.5f * squareDim);
+	float x = (float)((int)(viewW / 2 - (maze->getNumW() * squareDim) / 2) - originX);
+	if (right - left > (float)viewW) {
+		x = 0.5f * (float)viewW - targetX;
+		if (x > -left) x = -left;
+		if (x < (float)viewW - right) x = (float)viewW - right;
+	}
+	float y = (float)((int)(viewH / 2 - (maze->getNumH() * squareDim) / 2) - originY);
+	if (top - bottom > (float)viewH) {
+		y = 0.5f * (float)viewH - targetY;
+		if (y > -bottom) y = -bottom;
+		if (y < (float)viewH - top) y = (float)viewH - top;
+	}
+	setOffset(x, y);
+}
+
+bool vCamera::getIsVisible(float left, float bottom, float right, float top) {
+	return right + offsetX >= 0.0f && left + offsetX <= (float)viewW && top + offsetY >= 0.0f && bottom + offsetY <= (float)viewH;
+}
+
+void vCamera::getVisibleSquares(vMaze * maze, int * x0, int * y0, int * x1, int * y1) {
+	// Squares any part of which is in view, clamped to the maze
+	float squareDim = maze->getSquareDim();
+	float originX = (float)maze->mazeX2screenX(0) - 0.5f * squareDim;
+	float originY = (float)maze->mazeY2screenY(0) - 0.5f * squareDim;
+	*x0 = (int)floorf((-offsetX - originX) / squareDim);
+	*x1 = (int)floorf(((float)viewW - offsetX - originX) / squareDim);
+	*y0 = (int)floorf((-offsetY - originY) / squareDim);
+	*y1 = (int)floorf(((float)viewH - offsetY - originY) / squareDim);
+	if (*x0 < 0) *x0 = 0;
+	if (*y0 < 0) *y0 = 0;
+	if (*x1 > maze->getNumW() - 1) *x1 = maze->getNumW() - 1;
+	if (*y1 > maze->getNumH() - 1) *y1 = maze->getNumH() - 1;
+}
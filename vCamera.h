@@ -0,0 +1,43 @@
+/*	Brian Kirkpatrick
+	Pac-Man: Vengeance
+	Camera class
+	Begun Saturday, October 17th, 2026
+
+	The camera decides which part of the maze is on screen. Actors, walls and items are laid out in maze pixels (see
+	vMaze::mazeX2screenX); a maze that fits the view is centered in it, while a larger one is panned to keep the
+	selected ghost in the middle, stopping at the maze's edges. The view need not be the maze's viewport, so a match
+	simulated in one window can be drawn at any size. The camera also answers which squares and rectangles can be
+	seen, so recorders only submit what lands on screen.
+*/
+
+#ifndef VENGEANCE_CAMERA_H
+#define VENGEANCE_CAMERA_H
+
+#include "vMaze.h"
+
+class vCamera {
+private:
+	// Data
+	float offsetX, offsetY;		// Added to maze pixels to get screen pixels; whole pixels, so textures don't shimmer
+	int viewW, viewH;			// Size of the view, in pixels
+protected:
+public:
+	// Constructors
+	vCamera();
+	~vCamera();
+
+	// Accessors
+	float getOffsetX();
+	float getOffsetY();
+	int getViewW();
+	int getViewH();
+	void setOffset(float x, float y);
+	void setView(int w, int h);
+
+	// Methods
+	void follow(vMaze * maze, float alpha);		// Centers on the selection, blended like its sprite, within the maze
+	bool getIsVisible(float left, float bottom, float right, float top);	// Rectangle in maze pixels
+	void getVisibleSquares(vMaze * maze, int * x0, int * y0, int * x1, int * y1);	// Inclusive, within the maze; x1 < x0 if none
+};
+
+#endif
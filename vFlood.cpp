@@ -0,0 +1,489 @@
+/*	Brian Kirkpatrick
+	Pac-Man: Vengeance
+	Flood fill class
+	Begun Saturday, October 17th, 2026
+
+	The flood class computes reachability and breadth-first distance layers over the maze's wall bit grids, 64 squares
+	(or 256, with AVX2) at a time. Squares move sideways within a row by shifting whole words against the vertical
+	walls, and between rows by masking against the horizontal walls. Each flood object owns its scratch grids, so
+	separate objects can be used from separate threads.
+
+	Word-parallel steps pay for whole rows however few squares are moving, so winding mazes, where a flood front is a
+	handful of squares creeping along bent corridors, are finished with a plain scalar queue instead: fills after a
+	few sweeps, plots once a layer is sparse compared to the words it touches. Entry masks for plain plots are kept
+	until the maze's layout stamp changes.
+*/
+
+#include "vFlood.h"
+#include <stdlib.h>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// Full up-and-down sweeps a fill makes before finishing with the queue; open mazes are done well within this
+static const int maxSweeps = 4;
+
+// A plot layer goes to the queue once the words it touches outnumber its squares this many times over
+static const int sparseRatio = 2;
+
+// --- Word helpers --- //
+
+static int lowestBit(uint64_t w) {
+	// Index of the lowest set bit; w must be non-zero
+#if defined(_MSC_VER)
+	unsigned long index;
+	_BitScanForward64(&index, w);
+	return (int)index;
+#else
+	return __builtin_ctzll(w);
+#endif
+}
+
+static uint64_t fillUp(uint64_t gen, uint64_t pro) {
+	// Spreads gen towards higher bits through every run of pro it touches (Kogge-Stone occluded fill)
+	gen |= pro & (gen << 1);	pro &= pro << 1;
+	gen |= pro & (gen << 2);	pro &= pro << 2;
+	gen |= pro & (gen << 4);	pro &= pro << 4;
+	gen |= pro & (gen << 8);	pro &= pro << 8;
+	gen |= pro & (gen << 16);	pro &= pro << 16;
+	gen |= pro & (gen << 32);
+	return gen;
+}
+
+static uint64_t fillDown(uint64_t gen, uint64_t pro) {
+	// Spreads gen towards lower bits through every run of pro it touches
+	gen |= pro & (gen >> 1);	pro &= pro >> 1;
+	gen |= pro & (gen >> 2);	pro &= pro >> 2;
+	gen |= pro & (gen >> 4);	pro &= pro >> 4;
+	gen |= pro & (gen >> 8);	pro &= pro >> 8;
+	gen |= pro & (gen >> 16);	pro &= pro >> 16;
+	gen |= pro & (gen >> 32);
+	return gen;
+}
+
+#if defined(__AVX2__)
+static __m256i fillUp4(__m256i gen, __m256i pro) {
+	// fillUp() on four words at once
+	gen = _mm256_or_si256(gen, _mm256_and_si256(pro, _mm256_slli_epi64(gen, 1)));	pro = _mm256_and_si256(pro, _mm256_slli_epi64(pro, 1));
+	gen = _mm256_or_si256(gen, _mm256_and_si256(pro, _mm256_slli_epi64(gen, 2)));	pro = _mm256_and_si256(pro, _mm256_slli_epi64(pro, 2));
+	gen = _mm256_or_si256(gen, _mm256_and_si256(pro, _mm256_slli_epi64(gen, 4)));	pro = _mm256_and_si256(pro, _mm256_slli_epi64(pro, 4));
+	gen = _mm256_or_si256(gen, _mm256_and_si256(pro, _mm256_slli_epi64(gen, 8)));	pro = _mm256_and_si256(pro, _mm256_slli_epi64(pro, 8));
+	gen = _mm256_or_si256(gen, _mm256_and_si256(pro, _mm256_slli_epi64(gen, 16)));	pro = _mm256_and_si256(pro, _mm256_slli_epi64(pro, 16));
+	gen = _mm256_or_si256(gen, _mm256_and_si256(pro, _mm256_slli_epi64(gen, 32)));
+	return gen;
+}
+
+static __m256i fillDown4(__m256i gen, __m256i pro) {
+	// fillDown() on four words at once
+	gen = _mm256_or_si256(gen, _mm256_and_si256(pro, _mm256_srli_epi64(gen, 1)));	pro = _mm256_and_si256(pro, _mm256_srli_epi64(pro, 1));
+	gen = _mm256_or_si256(gen, _mm256_and_si256(pro, _mm256_srli_epi64(gen, 2)));	pro = _mm256_and_si256(pro, _mm256_srli_epi64(pro, 2));
+	gen = _mm256_or_si256(gen, _mm256_and_si256(pro, _mm256_srli_epi64(gen, 4)));	pro = _mm256_and_si256(pro, _mm256_srli_epi64(pro, 4));
+	gen = _mm256_or_si256(gen, _mm256_and_si256(pro, _mm256_srli_epi64(gen, 8)));	pro = _mm256_and_si256(pro, _mm256_srli_epi64(pro, 8));
+	gen = _mm256_or_si256(gen, _mm256_and_si256(pro, _mm256_srli_epi64(gen, 16)));	pro = _mm256_and_si256(pro, _mm256_srli_epi64(pro, 16));
+	gen = _mm256_or_si256(gen, _mm256_and_si256(pro, _mm256_srli_epi64(gen, 32)));
+	return gen;
+}
+
+static __m256i load4(uint64_t * p) {
+	return _mm256_loadu_si256((__m256i *)p);
+}
+
+static void store4(uint64_t * p, __m256i v) {
+	_mm256_storeu_si256((__m256i *)p, v);
+}
+#endif
+
+// --- Constructors --- //
+
+vFlood::vFlood() {
+	numW = 0;
+	numH = 0;
+	rowWords = 0;
+	layerStamp = 0;
+	activeRows = NULL;
+	candidateRows = NULL;
+	rowStamps = NULL;
+	isPrepared = false;
+	preparedVert = NULL;
+	preparedHoriz = NULL;
+	preparedStamp = 0;
+}
+
+vFlood::~vFlood() {
+	if (activeRows != NULL) {
+		delete[] activeRows;
+		activeRows = NULL;
+	}
+	if (candidateRows != NULL) {
+		delete[] candidateRows;
+		candidateRows = NULL;
+	}
+	if (rowStamps != NULL) {
+		delete[] rowStamps;
+		rowStamps = NULL;
+	}
+}
+
+// --- Private Methods --- //
+
+void vFlood::closeRow(uint64_t * row, uint64_t * left, uint64_t * right) {
+	// Spreads the row's bits sideways as far as the vertical walls allow
+	int k = 0;
+#if defined(__AVX2__)
+	for (; k + 4 <= rowWords; k += 4) {
+		store4(row + k, fillDown4(fillUp4(load4(row + k), load4(left + k)), load4(right + k)));
+	}
+#endif
+	for (; k < rowWords; k++) {
+		row[k] = fillDown(fillUp(row[k], left[k]), right[k]);
+	}
+
+	// Each word is now closed on its own; carry runs across word boundaries, rightwards then leftwards
+	for (k = 1; k < rowWords; k++) {
+		if ((row[k-1] >> 63) && (left[k] & 1) && !(row[k] & 1)) {
+			row[k] = fillDown(fillUp(row[k] | 1, left[k]), right[k]);
+		}
+	}
+	for (k = rowWords - 2; k >= 0; k--) {
+		if ((row[k+1] & 1) && (right[k] >> 63) && !(row[k] >> 63)) {
+			row[k] = fillDown(fillUp(row[k] | ((uint64_t)1 << 63), left[k]), right[k]);
+		}
+	}
+}
+
+void vFlood::stepWord(uint64_t * c, uint64_t * below, uint64_t * above, uint64_t * l, uint64_t * r, uint64_t * d, uint64_t * u, uint64_t * s, uint64_t * n, int k) {
+	// Moves word k of the current layer one square in every open direction, dropping squares already seen
+	uint64_t toRight = (c[k] << 1) | (k > 0 ? c[k-1] >> 63 : 0);
+	uint64_t toLeft = (c[k] >> 1) | (k + 1 < rowWords ? c[k+1] << 63 : 0);
+	uint64_t w = (toRight & l[k]) | (toLeft & r[k]);
+	if (below != NULL) w |= below[k] & d[k];
+	if (above != NULL) w |= above[k] & u[k];
+	n[k] = w & ~s[k];
+}
+
+void vFlood::fillQueue(BitGrid * reach) {
+	// Takes one more step from everything reached so far, then follows each new square depth-first; the order
+	// doesn't matter for reachability, so the queue is used as a stack
+	queue.clear();
+	for (int y = 0; y < numH; y++) {
+		uint64_t * c = reach->getRow(y);
+		uint64_t * below = y > 0 ? reach->getRow(y-1) : NULL;
+		uint64_t * above = y < numH - 1 ? reach->getRow(y+1) : NULL;
+		uint64_t * n = next.getRow(y);
+		for (int k = 0; k < rowWords; k++) {
+			stepWord(c, below, above, enterLeft.getRow(y), enterRight.getRow(y), enterBelow.getRow(y), enterAbove.getRow(y), c, n, k);
+		}
+	}
+	for (int y = 0; y < numH; y++) {
+		uint64_t * n = next.getRow(y);
+		uint64_t * c = reach->getRow(y);
+		for (int k = 0; k < rowWords; k++) {
+			uint64_t bits = n[k];
+			c[k] |= bits;
+			n[k] = 0;
+			while (bits != 0) {
+				queue.push_back((64 * k + lowestBit(bits)) * numH + y);
+				bits &= bits - 1;
+			}
+		}
+	}
+	while (!queue.empty()) {
+		int square = queue.back();
+		queue.pop_back();
+		int x = square / numH;
+		int y = square % numH;
+		if (enterLeft.get(x+1, y) && !reach->get(x+1, y)) {
+			reach->set(x+1, y);
+			queue.push_back(square + numH);
+		}
+		if (enterRight.get(x-1, y) && !reach->get(x-1, y)) {
+			reach->set(x-1, y);
+			queue.push_back(square - numH);
+		}
+		if (enterBelow.get(x, y+1) && !reach->get(x, y+1)) {
+			reach->set(x, y+1);
+			queue.push_back(square + 1);
+		}
+		if (enterAbove.get(x, y-1) && !reach->get(x, y-1)) {
+			reach->set(x, y-1);
+			queue.push_back(square - 1);
+		}
+	}
+}
+
+void vFlood::prepare(BitGrid * vertWalls, BitGrid * horizWalls, BitGrid * blocked, unsigned int stamp) {
+	// Builds the entry masks for the current walls; blocked squares can never be entered. Unblocked masks are kept
+	// until the walls or their stamp change.
+	int w = horizWalls->getWidth();
+	int h = vertWalls->getHeight();
+	if (blocked == NULL && isPrepared && vertWalls == preparedVert && horizWalls == preparedHoriz && stamp == preparedStamp && w == numW && h == numH) {
+		return;
+	}
+	resize(w, h);
+	isPrepared = blocked == NULL;
+	preparedVert = vertWalls;
+	preparedHoriz = horizWalls;
+	preparedStamp = stamp;
+	int vertWords = vertWalls->getRowWords();
+	for (int y = 0; y < numH; y++) {
+		uint64_t * v = vertWalls->getRow(y);
+		uint64_t * hBelow = horizWalls->getRow(y);
+		uint64_t * hAbove = horizWalls->getRow(y+1);
+		uint64_t * b = blocked != NULL ? blocked->getRow(y) : NULL;
+		uint64_t * l = enterLeft.getRow(y);
+		uint64_t * r = enterRight.getRow(y);
+		uint64_t * d = enterBelow.getRow(y);
+		uint64_t * u = enterAbove.getRow(y);
+		for (int k = 0; k < rowWords; k++) {
+			uint64_t open = enterLeft.getRowMask(k);
+			if (b != NULL) open &= ~b[k];
+			uint64_t vRight = (v[k] >> 1) | (k + 1 < vertWords ? v[k+1] << 63 : 0);
+			l[k] = ~v[k] & open;
+			r[k] = ~vRight & open;
+			d[k] = y > 0 ? ~hBelow[k] & open : 0;
+			u[k] = y < numH - 1 ? ~hAbove[k] & open : 0;
+		}
+
+		// Nothing enters from outside the maze
+		l[0] &= ~(uint64_t)1;
+		r[(numW - 1) / 64] &= ~((uint64_t)1 << ((numW - 1) % 64));
+	}
+}
+
+void vFlood::resize(int w, int h) {
+	// Reallocates scratch space only when the maze dimensions change
+	if (w == numW && h == numH) return;
+	numW = w;
+	numH = h;
+	rowWords = (w + 63) / 64;
+	enterLeft.resize(w, h);
+	enterRight.resize(w, h);
+	enterBelow.resize(w, h);
+	enterAbove.resize(w, h);
+	current.resize(w, h);
+	next.resize(w, h);
+	seen.resize(w, h);
+	if (activeRows != NULL) delete[] activeRows;
+	if (candidateRows != NULL) delete[] candidateRows;
+	if (rowStamps != NULL) delete[] rowStamps;
+	activeRows = new int[h > 0 ? h : 1];
+	candidateRows = new int[h > 0 ? h : 1];
+	rowStamps = new int[h > 0 ? h : 1];
+	for (int y = 0; y < h; y++) {
+		rowStamps[y] = 0;
+	}
+	layerStamp = 0;
+}
+
+// --- Methods --- //
+
+void vFlood::fill(BitGrid * vertWalls, BitGrid * horizWalls, BitGrid * reach, BitGrid * blocked) {
+	prepare(vertWalls, horizWalls, blocked, 0);
+
+	// Close every row sideways, then sweep up and down the maze passing bits through open horizontal walls, until
+	// a full sweep adds nothing. Only rows that gain bits are closed again. Each sweep only gets around so many bends,
+	// so a maze still growing after a few sweeps is winding, and is finished square by square.
+	for (int y = 0; y < numH; y++) {
+		closeRow(reach->getRow(y), enterLeft.getRow(y), enterRight.getRow(y));
+	}
+	bool changed = true;
+	for (int sweeps = 0; changed; sweeps++) {
+		if (sweeps == maxSweeps) {
+			fillQueue(reach);
+			return;
+		}
+		changed = false;
+		for (int pass = 0; pass < 2; pass++) {
+			int start = pass == 0 ? 1 : numH - 2;
+			int step = pass == 0 ? 1 : -1;
+			for (int y = start; y >= 0 && y < numH; y += step) {
+				uint64_t * row = reach->getRow(y);
+				uint64_t * from = reach->getRow(y - step);
+				uint64_t * mask = pass == 0 ? enterBelow.getRow(y) : enterAbove.getRow(y);
+				uint64_t gained = 0;
+				for (int k = 0; k < rowWords; k++) {
+					uint64_t incoming = from[k] & mask[k] & ~row[k];
+					row[k] |= incoming;
+					gained |= incoming;
+				}
+				if (gained != 0) {
+					closeRow(row, enterLeft.getRow(y), enterRight.getRow(y));
+					changed = true;
+				}
+			}
+		}
+	}
+}
+
+void vFlood::plot(BitGrid * vertWalls, BitGrid * horizWalls, unsigned int stamp, int * values, int x, int y) {
+	// Should only be looking from registered squares
+	if (values[x * vertWalls->getHeight() + y] == -1) return;
+	prepare(vertWalls, horizWalls, NULL, stamp);
+	current.fill(false);
+	next.fill(false);
+	seen.fill(false);
+	current.set(x, y);
+	seen.set(x, y);
+	activeRows[0] = y;
+	spread(values, 1, values[x * numH + y]);
+}
+
+void vFlood::plotMany(BitGrid * vertWalls, BitGrid * horizWalls, unsigned int stamp, int * values, const int * squares, int numSquares) {
+	// Every source starts the first layer at distance 0, so each square ends up with the distance to its nearest source
+	prepare(vertWalls, horizWalls, NULL, stamp);
+	for (int i = 0; i < numW * numH; i++) {
+		values[i] = -1;
+	}
+	current.fill(false);
+	next.fill(false);
+	seen.fill(false);
+	layerStamp++;
+	int numActive = 0;
+	for (int i = 0; i < numSquares; i++) {
+		int x = squares[i] / numH;
+		int y = squares[i] % numH;
+		if (x < 0 || x >= numW || y < 0 || y >= numH) continue;
+		current.set(x, y);
+		seen.set(x, y);
+		values[squares[i]] = 0;
+		if (rowStamps[y] != layerStamp) {
+			rowStamps[y] = layerStamp;
+			activeRows[numActive++] = y;
+		}
+	}
+	spread(values, numActive, 0);
+}
+
+void vFlood::spread(int * values, int numActive, int distance) {
+	// Each pass advances the whole layer by one step; only rows next to the current layer are touched. A layer with
+	// few squares for the words it would touch is handed to the queue, which finishes the plot.
+	int numSquares = 0;
+	while (numActive > 0) {
+		if (numSquares > 0 && numSquares * sparseRatio < numActive * rowWords) {
+			spreadQueue(values, numActive, distance);
+			return;
+		}
+
+		distance++;
+		layerStamp++;
+		int numCandidates = 0;
+		for (int i = 0; i < numActive; i++) {
+			for (int j = activeRows[i] - 1; j <= activeRows[i] + 1; j++) {
+				if (j >= 0 && j < numH && rowStamps[j] != layerStamp) {
+					rowStamps[j] = layerStamp;
+					candidateRows[numCandidates++] = j;
+				}
+			}
+		}
+
+		// Step sideways and vertically from the current layer into squares not yet seen
+		for (int i = 0; i < numCandidates; i++) {
+			int j = candidateRows[i];
+			uint64_t * c = current.getRow(j);
+			uint64_t * below = j > 0 ? current.getRow(j-1) : NULL;
+			uint64_t * above = j < numH - 1 ? current.getRow(j+1) : NULL;
+			uint64_t * l = enterLeft.getRow(j);
+			uint64_t * r = enterRight.getRow(j);
+			uint64_t * d = enterBelow.getRow(j);
+			uint64_t * u = enterAbove.getRow(j);
+			uint64_t * s = seen.getRow(j);
+			uint64_t * n = next.getRow(j);
+			// Word 0 and the tail have no neighbor on one side, so they always take the scalar path
+			stepWord(c, below, above, l, r, d, u, s, n, 0);
+			int k = 1;
+#if defined(__AVX2__)
+			for (; k + 4 < rowWords; k += 4) {
+				__m256i cc = load4(c + k);
+				__m256i toRight = _mm256_or_si256(_mm256_slli_epi64(cc, 1), _mm256_srli_epi64(load4(c + k - 1), 63));
+				__m256i toLeft = _mm256_or_si256(_mm256_srli_epi64(cc, 1), _mm256_slli_epi64(load4(c + k + 1), 63));
+				__m256i w = _mm256_or_si256(_mm256_and_si256(toRight, load4(l + k)), _mm256_and_si256(toLeft, load4(r + k)));
+				if (below != NULL) w = _mm256_or_si256(w, _mm256_and_si256(load4(below + k), load4(d + k)));
+				if (above != NULL) w = _mm256_or_si256(w, _mm256_and_si256(load4(above + k), load4(u + k)));
+				store4(n + k, _mm256_andnot_si256(load4(s + k), w));
+			}
+#endif
+			for (; k < rowWords; k++) {
+				stepWord(c, below, above, l, r, d, u, s, n, k);
+			}
+		}
+
+		// Retire the current layer, then promote the new one and record its distances
+		for (int i = 0; i < numActive; i++) {
+			current.fillRow(activeRows[i], false);
+		}
+		numActive = 0;
+		numSquares = 0;
+		for (int i = 0; i < numCandidates; i++) {
+			int j = candidateRows[i];
+			uint64_t * n = next.getRow(j);
+			uint64_t * c = current.getRow(j);
+			uint64_t * s = seen.getRow(j);
+			uint64_t any = 0;
+			for (int k = 0; k < rowWords; k++) {
+				uint64_t bits = n[k];
+				if (bits == 0) continue;
+				any |= bits;
+				c[k] = bits;
+				s[k] |= bits;
+				n[k] = 0;
+				while (bits != 0) {
+					int index = (64 * k + lowestBit(bits)) * numH + j;
+					if (values[index] == -1 || values[index] > distance) {
+						values[index] = distance;
+					}
+					bits &= bits - 1;
+					numSquares++;
+				}
+			}
+			if (any != 0) {
+				activeRows[numActive++] = j;
+			}
+		}
+	}
+}
+
+void vFlood::spreadQueue(int * values, int numActive, int distance) {
+	// Breadth-first from the current layer (in activeRows, at the given distance), one square at a time; squares are
+	// marked seen as they are queued, so each is queued once
+	queue.clear();
+	for (int i = 0; i < numActive; i++) {
+		int y = activeRows[i];
+		uint64_t * c = current.getRow(y);
+		for (int k = 0; k < rowWords; k++) {
+			uint64_t bits = c[k];
+			c[k] = 0;
+			while (bits != 0) {
+				queue.push_back((64 * k + lowestBit(bits)) * numH + y);
+				bits &= bits - 1;
+			}
+		}
+	}
+	size_t head = 0;
+	size_t layerEnd = queue.size();
+	while (head < queue.size()) {
+		if (head == layerEnd) {
+			distance++;
+			layerEnd = queue.size();
+		}
+		int square = queue[head++];
+		int x = square / numH;
+		int y = square % numH;
+		int neighbors[4] = { -1, -1, -1, -1 };
+		if (enterLeft.get(x+1, y) && !seen.get(x+1, y)) neighbors[0] = square + numH;
+		if (enterRight.get(x-1, y) && !seen.get(x-1, y)) neighbors[1] = square - numH;
+		if (enterBelow.get(x, y+1) && !seen.get(x, y+1)) neighbors[2] = square + 1;
+		if (enterAbove.get(x, y-1) && !seen.get(x, y-1)) neighbors[3] = square - 1;
+		for (int i = 0; i < 4; i++) {
+			int index = neighbors[i];
+			if (index == -1) continue;
+			seen.set(index / numH, index % numH);
+			if (values[index] == -1 || values[index] > distance + 1) {
+				values[index] = distance + 1;
+			}
+			queue.push_back(index);
+		}
+	}
+}
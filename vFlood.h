@@ -0,0 +1,72 @@
+/*	Brian Kirkpatrick
+	Pac-Man: Vengeance
+	Flood fill class
+	Begun Saturday, October 17th, 2026
+
+	The flood class computes reachability and breadth-first distance layers over the maze's wall bit grids, 64 squares
+	(or 256, with AVX2) at a time. Squares move sideways within a row by shifting whole words against the vertical
+	walls, and between rows by masking against the horizontal walls. Each flood object owns its scratch grids, so
+	separate objects can be used from separate threads.
+
+	Word-parallel steps pay for whole rows however few squares are moving, so winding mazes, where a flood front is a
+	handful of squares creeping along bent corridors, are finished with a plain scalar queue instead: fills after a
+	few sweeps, plots once a layer is sparse compared to the words it touches. Entry masks for plain plots are kept
+	until the maze's layout stamp changes.
+*/
+
+#ifndef VENGEANCE_FLOOD_H
+#define VENGEANCE_FLOOD_H
+
+#include "BitGrid.h"
+#include <vector>
+
+class vFlood {
+private:
+	// Data
+	int numW, numH;
+	int rowWords;
+	int layerStamp;
+	int * activeRows;		// Rows holding part of the current layer
+	int * candidateRows;	// Rows that may hold part of the next layer
+	int * rowStamps;		// Layer in which each row was last made a candidate
+	std::vector<int> queue;	// Scratch for the scalar finish, squares as x*numH+y
+
+	// What the entry masks were last built from; plots reuse them while these hold
+	bool isPrepared;
+	BitGrid * preparedVert;
+	BitGrid * preparedHoriz;
+	unsigned int preparedStamp;
+
+	// Masks (numW x numH): bit x,y is set if square x,y can be entered from the given neighbor
+	BitGrid enterLeft;
+	BitGrid enterRight;
+	BitGrid enterBelow;
+	BitGrid enterAbove;
+
+	// Layers
+	BitGrid current;
+	BitGrid next;
+	BitGrid seen;
+
+	// Methods
+	void closeRow(uint64_t * row, uint64_t * left, uint64_t * right);
+	void stepWord(uint64_t * c, uint64_t * below, uint64_t * above, uint64_t * l, uint64_t * r, uint64_t * d, uint64_t * u, uint64_t * s, uint64_t * n, int k);
+	void prepare(BitGrid * vertWalls, BitGrid * horizWalls, BitGrid * blocked, unsigned int stamp);	// Kept for plots, never fills
+	void resize(int w, int h);
+	void spread(int * values, int numActive, int distance);	// Grows the current layer (in activeRows) to the whole maze
+	void spreadQueue(int * values, int numActive, int distance);	// As spread, one square at a time from the current layer
+	void fillQueue(BitGrid * reach);						// Finishes a fill one square at a time
+protected:
+public:
+	// Constructors
+	vFlood();
+	~vFlood();
+
+	// Methods
+	void fill(BitGrid * vertWalls, BitGrid * horizWalls, BitGrid * reach, BitGrid * blocked=0);	// Grows reach to everything reachable from it, never entering blocked squares
+	// Plots take the maze's layout stamp, so the entry masks are only rebuilt when the walls change
+	void plot(BitGrid * vertWalls, BitGrid * horizWalls, unsigned int stamp, int * values, int x, int y);			// Distance layers outwards from x,y; same contract as vMaze::aStarPlot
+	void plotMany(BitGrid * vertWalls, BitGrid * horizWalls, unsigned int stamp, int * values, const int * squares, int numSquares);	// Distance to the nearest of several squares (x*numH+y); -1 if none reachable
+};
+
+#endif
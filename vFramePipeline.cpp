@@ -0,0 +1,135 @@
+/*	Brian Kirkpatrick
+	Pac-Man: Vengeance
+	Frame pipeline class
+	Begun Saturday, October 17th, 2026
+
+	The frame pipeline overlaps the three stages of rendering a run of frames offline: the caller records each frame
+	into a render list, worker threads rasterize recorded frames (several at once, one frame per worker), and a single
+	output thread hands finished frames to a callback strictly in order, for encoding. Frames live in a ring of slots,
+	so the caller blocks when it gets too far ahead and memory stays bounded however long the run is.
+*/
+
+#include "vFramePipeline.h"
+
+// --- Constructors --- //
+
+vFramePipeline::vFramePipeline(vRasterizer * r, frameCallback c, void * o, int numWorkers, int depth) {
+	rasterizer = r;
+	callback = c;
+	owner = o;
+	numRecorded = 0;
+	numOutput = 0;
+	isStopping = false;
+	if (numWorkers <= 0) numWorkers = (int)std::thread::hardware_concurrency();
+	if (numWorkers < 1) numWorkers = 1;
+	if (depth <= 0) depth = 2 * numWorkers + 2;
+	for (int i = 0; i < depth; i++) {
+		frameSlot * s = new frameSlot();
+		s->index = -1;
+		s->state = FS_FREE;
+		slots.push_back(s);
+	}
+	for (int i = 0; i < numWorkers; i++) {
+		workers.push_back(std::thread(&vFramePipeline::drawFrames, this));
+	}
+	output = std::thread(&vFramePipeline::outputFrames, this);
+}
+
+vFramePipeline::~vFramePipeline() {
+	finish();
+	for (size_t i = 0; i < slots.size(); i++) {
+		delete slots[i];
+	}
+	slots.clear();
+}
+
+// --- Private Methods --- //
+
+void vFramePipeline::drawFrames() {
+	// Oldest recorded frame first, so the output thread is never left waiting on a frame nobody has started
+	std::unique_lock<std::mutex> guard(lock);
+	while (true) {
+		frameSlot * next = NULL;
+		for (size_t i = 0; i < slots.size(); i++) {
+			if (slots[i]->state == FS_RECORDED && (next == NULL || slots[i]->index < next->index)) next = slots[i];
+		}
+		if (next == NULL) {
+			if (isStopping) return;
+			changed.wait(guard);
+			continue;
+		}
+		next->state = FS_DRAWING;
+		guard.unlock();
+		rasterizer->render(&next->list, &next->image);
+		guard.lock();
+		next->state = FS_DRAWN;
+		changed.notify_all();
+	}
+}
+
+void vFramePipeline::outputFrames() {
+	std::unique_lock<std::mutex> guard(lock);
+	while (true) {
+		frameSlot * next = slots[numOutput % slots.size()];
+		if (next->state == FS_DRAWN && next->index == numOutput) {
+			guard.unlock();
+			callback(owner, &next->image, next->index);
+			guard.lock();
+			next->state = FS_FREE;
+			numOutput++;
+			changed.notify_all();
+		} else if (isStopping && numOutput == numRecorded) {
+			return;
+		} else {
+			changed.wait(guard);
+		}
+	}
+}
+
+// --- Accessors --- //
+
+int vFramePipeline::getNumOutput() {
+	std::lock_guard<std::mutex> guard(lock);
+	return numOutput;
+}
+
+// --- Methods --- //
+
+vRenderList * vFramePipeline::acquire() {
+	// Frame n always goes in slot n mod depth, which is what keeps the output in order
+	std::unique_lock<std::mutex> guard(lock);
+	frameSlot * s = slots[numRecorded % slots.size()];
+	while (s->state != FS_FREE) {
+		changed.wait(guard);
+	}
+	s->state = FS_RECORDING;
+	s->index = numRecorded;
+	s->list.clear();
+	return &s->list;
+}
+
+void vFramePipeline::submit() {
+	std::lock_guard<std::mutex> guard(lock);
+	frameSlot * s = slots[numRecorded % slots.size()];
+	if (s->state != FS_RECORDING) return;
+	s->state = FS_RECORDED;
+	numRecorded++;
+	changed.notify_all();
+}
+
+void vFramePipeline::finish() {
+	{
+		std::unique_lock<std::mutex> guard(lock);
+		if (isStopping) return;
+		while (numOutput < numRecorded) {
+			changed.wait(guard);
+		}
+		isStopping = true;
+		changed.notify_all();
+	}
+	for (size_t i = 0; i < workers.size(); i++) {
+		workers[i].join();
+	}
+	workers.clear();
+	output.join();
+}
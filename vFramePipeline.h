@@ -0,0 +1,67 @@
+/*	Brian Kirkpatrick
+	Pac-Man: Vengeance
+	Frame pipeline class
+	Begun Saturday, October 17th, 2026
+
+	The frame pipeline overlaps the three stages of rendering a run of frames offline: the caller records each frame
+	into a render list, worker threads rasterize recorded frames (several at once, one frame per worker), and a single
+	output thread hands finished frames to a callback strictly in order, for encoding. Frames live in a ring of slots,
+	so the caller blocks when it gets too far ahead and memory stays bounded however long the run is.
+*/
+
+#ifndef VENGEANCE_FRAME_PIPELINE_H
+#define VENGEANCE_FRAME_PIPELINE_H
+
+#include "vImage.h"
+#include "vRasterizer.h"
+#include "vRenderList.h"
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Called on the output thread with each finished frame, in order
+typedef void (*frameCallback)(void * owner, vImage * frame, int index);
+
+class vFramePipeline {
+private:
+	enum slotState { FS_FREE, FS_RECORDING, FS_RECORDED, FS_DRAWING, FS_DRAWN };
+	struct frameSlot {
+		vRenderList list;
+		vImage image;
+		int index;
+		slotState state;
+	};
+
+	// Data
+	vRasterizer * rasterizer;	// Shared by the workers; not owned
+	frameCallback callback;
+	void * owner;
+	std::vector<frameSlot *> slots;
+	int numRecorded;		// Frames handed over by the caller
+	int numOutput;			// Frames passed to the callback
+	bool isStopping;
+	std::mutex lock;
+	std::condition_variable changed;
+	std::vector<std::thread> workers;
+	std::thread output;
+
+	// Methods
+	void drawFrames();
+	void outputFrames();
+protected:
+public:
+	// Constructors
+	vFramePipeline(vRasterizer * r, frameCallback c, void * o, int numWorkers=0, int depth=0);	// 0s pick for the machine
+	~vFramePipeline();		// Finishes first
+
+	// Accessors
+	int getNumOutput();
+
+	// Methods
+	vRenderList * acquire();	// Blocks until a slot is free; record the next frame into the (empty) list it returns
+	void submit();				// Hands the acquired frame on
+	void finish();				// Blocks until every submitted frame has been output, then stops the threads
+};
+
+#endif
@@ -0,0 +1,69 @@
+/*	Brian Kirkpatrick
+	Pac-Man: Vengeance
+	Ghost controller classes
+	Begun Saturday, October 17th, 2026
+
+	A ghost controller stands in for the player when levels are simulated without one. Whenever a living ghost reaches
+	the middle of a square, the batch runner asks its controller which way to turn. Controllers keep no per-maze state,
+	so one controller can steer ghosts in many mazes on many threads at once.
+
+	The chase controller heads straight for the nearest pacman's square; the ambush controller heads for that pacman's
+	waypoint, to cut him off.
+*/
+
+#include "vGhostController.h"
+#include "vRouteTable.h"
+#include <stdlib.h>
+
+// --- vGhostController --- //
+
+vGhostController::vGhostController() {
+}
+
+vGhostController::~vGhostController() {
+}
+
+MazeDirection vGhostController::routeTowards(vMaze * maze, vActor * ghost, int destX, int destY) {
+	// First step along a shortest path, from the maze's route table; without one, close the larger gap in a straight line
+	int cx = maze->screenX2mazeX((int)(ghost->getX()));
+	int cy = maze->screenY2mazeY((int)(ghost->getY()));
+	if (maze->getRouteTable()->getIsBuilt()) {
+		return maze->getRouteTable()->getHop(cx, cy, destX, destY);
+	}
+	int gapX = destX - cx;
+	int gapY = destY - cy;
+	if (gapX == 0 && gapY == 0) return MD_NONE;
+	if (abs(gapX) >= abs(gapY)) {
+		return gapX > 0 ? MD_RIGHT : MD_LEFT;
+	}
+	return gapY > 0 ? MD_UP : MD_DOWN;
+}
+
+// --- vChaseController --- //
+
+MazeDirection vChaseController::steer(vMaze * maze, vActor * ghost) {
+	// Down the maze's shared distance field to the nearest pacman; every ghost reads the same plot each tick
+	int cx = maze->screenX2mazeX((int)(ghost->getX()));
+	int cy = maze->screenY2mazeY((int)(ghost->getY()));
+	if (cx < 0 || cx >= maze->getNumW() || cy < 0 || cy >= maze->getNumH()) return MD_NONE;
+	int * field = maze->getPreyField();
+	if (field[cx * maze->getNumH() + cy] <= 0) return MD_NONE;
+	return maze->stepTowards(field, cx, cy);
+}
+
+// --- vAmbushController --- //
+
+MazeDirection vAmbushController::steer(vMaze * maze, vActor * ghost) {
+	// Falls back to chasing until pacman has picked a waypoint, or once a ghost is already there
+	int cx = maze->screenX2mazeX((int)(ghost->getX()));
+	int cy = maze->screenY2mazeY((int)(ghost->getY()));
+	vActor * target = maze->findNearest(cx, cy, false);
+	if (target == NULL) return MD_NONE;
+	int wayX = target->getWayX();
+	int wayY = target->getWayY();
+	if (wayX < 0 || wayY < 0 || (wayX == cx && wayY == cy)) {
+		wayX = maze->screenX2mazeX((int)(target->getX()));
+		wayY = maze->screenY2mazeY((int)(target->getY()));
+	}
+	return routeTowards(maze, ghost, wayX, wayY);
+}
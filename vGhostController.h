@@ -0,0 +1,42 @@
+/*	Brian Kirkpatrick
+	Pac-Man: Vengeance
+	Ghost controller classes
+	Begun Saturday, October 17th, 2026
+
+	A ghost controller stands in for the player when levels are simulated without one. Whenever a living ghost reaches
+	the middle of a square, the batch runner asks its controller which way to turn. Controllers keep no per-maze state,
+	so one controller can steer ghosts in many mazes on many threads at once.
+
+	The chase controller heads straight for the nearest pacman's square; the ambush controller heads for that pacman's
+	waypoint, to cut him off.
+*/
+
+#ifndef VENGEANCE_GHOST_CONTROLLER_H
+#define VENGEANCE_GHOST_CONTROLLER_H
+
+#include "vMaze.h"
+
+class vGhostController {
+private:
+protected:
+	MazeDirection routeTowards(vMaze * maze, vActor * ghost, int destX, int destY);
+public:
+	// Constructors
+	vGhostController();
+	virtual ~vGhostController();
+
+	// Methods
+	virtual MazeDirection steer(vMaze * maze, vActor * ghost) = 0;	// MD_NONE keeps the current heading
+};
+
+class vChaseController : public vGhostController {
+public:
+	MazeDirection steer(vMaze * maze, vActor * ghost);
+};
+
+class vAmbushController : public vGhostController {
+public:
+	MazeDirection steer(vMaze * maze, vActor * ghost);
+};
+
+#endif
@@ -0,0 +1,210 @@
+/*	Brian Kirkpatrick
+	Pac-Man: Vengeance
+	Image class
+	Begun Saturday, October 17th, 2026
+
+	The image class is a plain RGBA bitmap in memory, 8 bits per channel, with row 0 at the top. It reads and writes
+	non-interlaced 8-bit PNGs (grey, RGB and their alpha forms) through zlib, which is all the software rasterizer
+	needs to sample the texture map and save frames.
+*/
+
+#include "vImage.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zlib.h>
+
+static const unsigned char pngSignature[8] = { 137, 80, 78, 71, 13, 10, 26, 10 };
+
+static unsigned int readBE(const unsigned char * p) {
+	return ((unsigned int)p[0] << 24) | ((unsigned int)p[1] << 16) | ((unsigned int)p[2] << 8) | (unsigned int)p[3];
+}
+
+static void writeBE(unsigned char * p, unsigned int v) {
+	p[0] = (unsigned char)(v >> 24);
+	p[1] = (unsigned char)(v >> 16);
+	p[2] = (unsigned char)(v >> 8);
+	p[3] = (unsigned char)v;
+}
+
+static bool writeChunk(FILE * f, const char * type, const unsigned char * data, size_t n) {
+	// Length, type, data, then a CRC of the type and data
+	unsigned char header[8];
+	writeBE(header, (unsigned int)n);
+	memcpy(header + 4, type, 4);
+	uLong crc = crc32(0L, Z_NULL, 0);
+	crc = crc32(crc, header + 4, 4);
+	if (n > 0) crc = crc32(crc, data, (uInt)n);
+	unsigned char footer[4];
+	writeBE(footer, (unsigned int)crc);
+	return fwrite(header, 1, 8, f) == 8 && (n == 0 || fwrite(data, 1, n, f) == n) && fwrite(footer, 1, 4, f) == 4;
+}
+
+static int paeth(int a, int b, int c) {
+	int p = a + b - c;
+	int pa = abs(p - a);
+	int pb = abs(p - b);
+	int pc = abs(p - c);
+	if (pa <= pb && pa <= pc) return a;
+	return pb <= pc ? b : c;
+}
+
+// --- Constructors --- //
+
+vImage::vImage() {
+	width = 0;
+	height = 0;
+}
+
+vImage::~vImage() {
+	// Nothing to destroy
+}
+
+// --- Accessors --- //
+
+int vImage::getHeight() {
+	return height;
+}
+
+unsigned char * vImage::getPixels() {
+	return pixels.empty() ? NULL : &pixels[0];
+}
+
+unsigned char * vImage::getRow(int y) {
+	return pixels.empty() ? NULL : &pixels[(size_t)y * width * 4];
+}
+
+int vImage::getWidth() {
+	return width;
+}
+
+// --- Methods --- //
+
+void vImage::fill(unsigned char r, unsigned char g, unsigned char b, unsigned char a) {
+	for (size_t i = 0; i < pixels.size(); i += 4) {
+		pixels[i] = r;
+		pixels[i + 1] = g;
+		pixels[i + 2] = b;
+		pixels[i + 3] = a;
+	}
+}
+
+bool vImage::loadPng(const char * filename) {
+	resize(0, 0);
+	FILE * f = fopen(filename, "rb");
+	if (f == NULL) return false;
+	std::vector<unsigned char> file;
+	unsigned char buffer[65536];
+	size_t n;
+	while ((n = fread(buffer, 1, sizeof(buffer), f)) > 0) {
+		file.insert(file.end(), buffer, buffer + n);
+	}
+	fclose(f);
+	if (file.size() < 8 || memcmp(&file[0], pngSignature, 8) != 0) return false;
+
+	// Walk the chunks, keeping the header and gathering the compressed data
+	int w = 0, h = 0, channels = 0;
+	std::vector<unsigned char> compressed;
+	size_t at = 8;
+	while (at + 12 <= file.size()) {
+		size_t length = readBE(&file[at]);
+		const unsigned char * type = &file[at + 4];
+		const unsigned char * data = &file[at + 8];
+		if (at + 12 + length > file.size()) return false;
+		if (memcmp(type, "IHDR", 4) == 0 && length >= 13) {
+			w = (int)readBE(data);
+			h = (int)readBE(data + 4);
+			int bitDepth = data[8];
+			int colorType = data[9];
+			int interlace = data[12];
+			if (bitDepth != 8 || interlace != 0) return false;
+			switch (colorType) {
+				case 0: channels = 1; break;	// Grey
+				case 2: channels = 3; break;	// RGB
+				case 4: channels = 2; break;	// Grey and alpha
+				case 6: channels = 4; break;	// RGBA
+				default: return false;			// Palettes aren't used by anything we ship
+			}
+		} else if (memcmp(type, "IDAT", 4) == 0) {
+			compressed.insert(compressed.end(), data, data + length);
+		} else if (memcmp(type, "IEND", 4) == 0) {
+			break;
+		}
+		at += 12 + length;
+	}
+	if (w <= 0 || h <= 0 || channels == 0 || compressed.empty()) return false;
+
+	// Each row is a filter byte, then the filtered samples
+	size_t stride = (size_t)w * channels;
+	std::vector<unsigned char> raw((stride + 1) * h);
+	uLongf rawLength = (uLongf)raw.size();
+	if (uncompress(&raw[0], &rawLength, &compressed[0], (uLong)compressed.size()) != Z_OK || rawLength != raw.size()) return false;
+	std::vector<unsigned char> prior(stride, 0);
+	std::vector<unsigned char> row(stride);
+	resize(w, h);
+	for (int y = 0; y < h; y++) {
+		const unsigned char * in = &raw[y * (stride + 1)];
+		int filter = in[0];
+		in++;
+		for (size_t i = 0; i < stride; i++) {
+			int a = i >= (size_t)channels ? row[i - channels] : 0;
+			int b = prior[i];
+			int c = i >= (size_t)channels ? prior[i - channels] : 0;
+			int x = in[i];
+			switch (filter) {
+				case 1: x += a; break;
+				case 2: x += b; break;
+				case 3: x += (a + b) / 2; break;
+				case 4: x += paeth(a, b, c); break;
+				default: break;
+			}
+			row[i] = (unsigned char)x;
+		}
+		unsigned char * out = getRow(y);
+		for (int i = 0; i < w; i++) {
+			const unsigned char * s = &row[(size_t)i * channels];
+			switch (channels) {
+				case 1: out[0] = out[1] = out[2] = s[0]; out[3] = 255; break;
+				case 2: out[0] = out[1] = out[2] = s[0]; out[3] = s[1]; break;
+				case 3: out[0] = s[0]; out[1] = s[1]; out[2] = s[2]; out[3] = 255; break;
+				default: out[0] = s[0]; out[1] = s[1]; out[2] = s[2]; out[3] = s[3]; break;
+			}
+			out += 4;
+		}
+		prior.swap(row);
+	}
+	return true;
+}
+
+void vImage::resize(int w, int h) {
+	width = w > 0 ? w : 0;
+	height = h > 0 ? h : 0;
+	pixels.assign((size_t)width * height * 4, 0);
+}
+
+bool vImage::savePng(const char * filename) {
+	// RGBA, every row unfiltered; zlib does the rest
+	if (width <= 0 || height <= 0) return false;
+	size_t stride = (size_t)width * 4;
+	std::vector<unsigned char> raw((stride + 1) * height);
+	for (int y = 0; y < height; y++) {
+		raw[y * (stride + 1)] = 0;
+		memcpy(&raw[y * (stride + 1) + 1], getRow(y), stride);
+	}
+	uLongf compressedLength = compressBound((uLong)raw.size());
+	std::vector<unsigned char> compressed(compressedLength);
+	if (compress2(&compressed[0], &compressedLength, &raw[0], (uLong)raw.size(), Z_DEFAULT_COMPRESSION) != Z_OK) return false;
+
+	unsigned char header[13];
+	writeBE(header, (unsigned int)width);
+	writeBE(header + 4, (unsigned int)height);
+	header[8] = 8;		// Bit depth
+	header[9] = 6;		// RGBA
+	header[10] = 0;		// Deflate
+	header[11] = 0;		// Adaptive filtering
+	header[12] = 0;		// Not interlaced
+	FILE * f = fopen(filename, "wb");
+	if (f == NULL) return false;
+	bool ok = fwrite(pngSignature, 1, 8, f) == 8 && writeChunk(f, "IHDR", header, 13) && writeChunk(f, "IDAT", &compressed[0], compressedLength) && writeChunk(f, "IEND", NULL, 0);
+	return fclose(f) == 0 && ok;
+}
@@ -0,0 +1,41 @@
+/*	Brian Kirkpatrick
+	Pac-Man: Vengeance
+	Image class
+	Begun Saturday, October 17th, 2026
+
+	The image class is a plain RGBA bitmap in memory, 8 bits per channel, with row 0 at the top. It reads and writes
+	non-interlaced 8-bit PNGs (grey, RGB and their alpha forms) through zlib, which is all the software rasterizer
+	needs to sample the texture map and save frames.
+*/
+
+#ifndef VENGEANCE_IMAGE_H
+#define VENGEANCE_IMAGE_H
+
+#include <stddef.h>
+#include <vector>
+
+class vImage {
+private:
+	// Data
+	int width, height;
+	std::vector<unsigned char> pixels;	// width*height*4, row by row from the top
+protected:
+public:
+	// Constructors
+	vImage();
+	~vImage();
+
+	// Accessors
+	int getHeight();
+	unsigned char * getPixels();
+	unsigned char * getRow(int y);
+	int getWidth();
+
+	// Methods
+	void fill(unsigned char r, unsigned char g, unsigned char b, unsigned char a);
+	bool loadPng(const char * filename);	// False (and the image left empty) if the file can't be read
+	void resize(int w, int h);				// Contents are cleared to transparent black
+	bool savePng(const char * filename);
+};
+
+#endif
@@ -0,0 +1,131 @@
+/*	Brian Kirkpatrick
+	Pac-Man: Vengeance
+	Item grid class
+	Begun Saturday, October 17th, 2026
+
+	The item grid holds the items in a maze, which are consumed by pacman for a specific point value. Each square has
+	one byte for its item type and one bit for whether its item is gone (eaten, or never in play), so a whole level
+	of items costs a little over a byte per square. Items have no screen state of their own; see vRenderer for drawing.
+
+	The itemTally struct keeps running counts and points for a level's items; the grid updates it as items are
+	consumed, so totals never need a walk over the grid
+*/
+
+#include "vItemGrid.h"
+
+// Point value of an item increases by 10 for each increase in item level
+static int pointsFor(itemType t) {
+	return 10 * ((int)t + 1);
+}
+
+// --- itemTally --- //
+
+itemTally::itemTally() {
+	reset();
+}
+
+int itemTally::getRemaining(itemType t) {
+	return placed[(int)t] - consumed[(int)t];
+}
+
+void itemTally::reset() {
+	for (int i = 0; i < numItemTypes; i++) {
+		placed[i] = 0;
+		consumed[i] = 0;
+	}
+	placedPoints = 0;
+	remainingPoints = 0;
+}
+
+// --- Constructors --- //
+
+vItemGrid::vItemGrid() {
+	numW = 0;
+	numH = 0;
+	types = NULL;
+}
+
+vItemGrid::~vItemGrid() {
+	if (types != NULL) {
+		delete[] types;
+		types = NULL;
+	}
+}
+
+// --- Accessors --- //
+
+bool vItemGrid::getIsConsumed(int x, int y) {
+	if (x < 0 || x >= numW || y < 0 || y >= numH) return true;
+	return consumed.get(x, y);
+}
+
+int vItemGrid::getPointValue(int x, int y) {
+	return getIsConsumed(x, y) ? 0 : pointsFor((itemType)types[x * numH + y]);
+}
+
+itemType vItemGrid::getItemType(int x, int y) {
+	if (x < 0 || x >= numW || y < 0 || y >= numH) return IT_SMALL_DOT;
+	return (itemType)types[x * numH + y];
+}
+
+itemTally vItemGrid::getTally() {
+	return tally;
+}
+
+size_t vItemGrid::getBytes() {
+	return (size_t)numW * numH + consumed.getBytes();
+}
+
+void vItemGrid::setItemType(int x, int y, itemType t) {
+	// Items still in play move from one type's count to the other's
+	if (x < 0 || x >= numW || y < 0 || y >= numH) return;
+	itemType old = (itemType)types[x * numH + y];
+	if (!consumed.get(x, y)) {
+		tally.placed[(int)old]--;
+		tally.placed[(int)t]++;
+		tally.placedPoints += pointsFor(t) - pointsFor(old);
+		tally.remainingPoints += pointsFor(t) - pointsFor(old);
+	}
+	types[x * numH + y] = (unsigned char)t;
+}
+
+// --- Methods --- //
+
+int vItemGrid::consume(int x, int y) {
+	int toReturn = getPointValue(x, y);
+	if (!getIsConsumed(x, y)) {
+		itemType t = (itemType)types[x * numH + y];
+		tally.consumed[(int)t]++;
+		tally.remainingPoints -= pointsFor(t);
+		consumed.set(x, y);
+	}
+	return toReturn;
+}
+
+void vItemGrid::disable(int x, int y) {
+	// Never in play, so it leaves the level's placed counts rather than counting as consumed
+	if (getIsConsumed(x, y)) return;
+	itemType t = (itemType)types[x * numH + y];
+	tally.placed[(int)t]--;
+	tally.placedPoints -= pointsFor(t);
+	tally.remainingPoints -= pointsFor(t);
+	consumed.set(x, y);
+}
+
+void vItemGrid::resize(int w, int h) {
+	numW = w > 0 ? w : 0;
+	numH = h > 0 ? h : 0;
+	if (types != NULL) {
+		delete[] types;
+		types = NULL;
+	}
+	types = new unsigned char[numW * numH > 0 ? numW * numH : 1];
+	for (int i = 0; i < numW * numH; i++) {
+		types[i] = (unsigned char)IT_SMALL_DOT;
+	}
+	consumed.resize(numW, numH);
+	tally.reset();
+	tally.placed[(int)IT_SMALL_DOT] = numW * numH;
+	tally.placedPoints = numW * numH * pointsFor(IT_SMALL_DOT);
+	tally.remainingPoints = tally.placedPoints;
+}
@@ -0,0 +1,63 @@
+/*	Brian Kirkpatrick
+	Pac-Man: Vengeance
+	Item grid class
+	Begun Saturday, October 17th, 2026
+
+	The item grid holds the items in a maze, which are consumed by pacman for a specific point value. Each square has
+	one byte for its item type and one bit for whether its item is gone (eaten, or never in play), so a whole level
+	of items costs a little over a byte per square. Items have no screen state of their own; see vRenderer for drawing.
+
+	The itemTally struct keeps running counts and points for a level's items; the grid updates it as items are
+	consumed, so totals never need a walk over the grid
+*/
+
+#ifndef VENGEANCE_ITEM_GRID_H
+#define VENGEANCE_ITEM_GRID_H
+
+#include "BitGrid.h"
+#include <stddef.h>
+
+// Item type: integer equivalents correspond to row in texture map
+enum itemType { IT_SMALL_DOT, IT_LARGE_DOT, IT_BANANA, IT_PEAR, IT_APPLE, IT_PRETZEL, IT_PEACH, IT_STRAWBERRY, IT_CHERRIES };
+static const int numItemTypes = 9;
+
+struct itemTally {
+	int placed[numItemTypes];	// Items of each type in play when the level was laid out
+	int consumed[numItemTypes];	// Of those, how many are gone
+	int placedPoints;
+	int remainingPoints;
+
+	// Methods
+	itemTally();
+	int getRemaining(itemType t);
+	void reset();
+};
+
+class vItemGrid {
+private:
+	// Data
+	int numW, numH;
+	unsigned char * types;	// numW*numH, indexed x*numH+y like the maze's squares
+	BitGrid consumed;		// numW x numH
+	itemTally tally;
+protected:
+public:
+	// Constructors
+	vItemGrid();
+	~vItemGrid();
+
+	// Accessors
+	bool getIsConsumed(int x, int y);	// Squares outside the grid read as consumed
+	int getPointValue(int x, int y);	// 0 once consumed
+	itemType getItemType(int x, int y);
+	itemTally getTally();
+	size_t getBytes();
+	void setItemType(int x, int y, itemType t);
+
+	// Methods
+	int consume(int x, int y);		// Returns the points it was worth
+	void disable(int x, int y);		// Takes the item out of play, for no points
+	void resize(int w, int h);		// Every square gets an uneaten small dot
+};
+
+#endif
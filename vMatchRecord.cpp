@@ -0,0 +1,230 @@
+/*	Brian Kirkpatrick
+	Pac-Man: Vengeance
+	Match record class
+	Begun Saturday, October 17th, 2026
+
+	The match record captures one level of play so it can be re-simulated exactly, headless: the level, its seed,
+	cast and viewport, the clock and the per-actor state that carries over from earlier levels (ability levels and
+	cooldowns, waypoints, animation phase), and then every input, stamped with the simulation step it was given
+	before. Everything else in a level follows from its seed, so replaying the inputs at the same steps through
+	vMaze::update plays the same match, tick for tick.
+
+	Records are saved as plain text, one field or input per line.
+*/
+
+#include "vMatchRecord.h"
+#include <stdio.h>
+
+static const int recordVersion = 2;
+
+// --- Constructors --- //
+
+vMatchRecord::vMatchRecord() {
+	level = 1;
+	levelSeed = 0;
+	numPacmen = 1;
+	numGhosts = 4;
+	viewW = 870;
+	viewH = 675;
+	stepLength = 0.01f;
+	startTime = 0.0;
+	startPaused = false;
+	numSteps = 0;
+	nextInput = 0;
+}
+
+vMatchRecord::~vMatchRecord() {
+	// Nothing to destroy
+}
+
+// --- Accessors --- //
+
+int vMatchRecord::getLevel() {
+	return level;
+}
+
+uint64_t vMatchRecord::getLevelSeed() {
+	return levelSeed;
+}
+
+int vMatchRecord::getNumInputs() {
+	return (int)inputs.size();
+}
+
+int vMatchRecord::getNumSteps() {
+	return numSteps;
+}
+
+float vMatchRecord::getStepLength() {
+	return stepLength;
+}
+
+// --- Recording --- //
+
+void vMatchRecord::begin(vMaze * maze, float dt) {
+	level = maze->getLevel();
+	levelSeed = maze->getLevelSeed();
+	numPacmen = maze->getNumPacmen();
+	numGhosts = maze->getNumGhosts();
+	viewW = maze->getViewW();
+	viewH = maze->getViewH();
+	stepLength = dt;
+	startTime = maze->getTime();
+	startPaused = maze->getIsPaused();
+	numSteps = 0;
+	nextInput = 0;
+	inputs.clear();
+	actorStarts.clear();
+	vActorTable * actors = maze->getActorTable();
+	for (int i = 0; i < actors->getSize(); i++) {
+		matchActorStart a;
+		a.state = actors->state[i];
+		a.timeSeed = actors->timeSeed[i];
+		a.velocity = actors->velocity[i];
+		a.level = actors->level[i];
+		a.wayX = actors->wayX[i];
+		a.wayY = actors->wayY[i];
+		a.flags = actors->flags[i];
+		a.mode = actors->mode[i];
+		a.abilityTriggered = actors->abilityTriggered[i];
+		actorStarts.push_back(a);
+	}
+}
+
+void vMatchRecord::addInput(matchInputType type, int slot, MazeDirection direction) {
+	matchInput in;
+	in.step = numSteps;
+	in.type = type;
+	in.slot = slot;
+	in.direction = direction;
+	inputs.push_back(in);
+}
+
+void vMatchRecord::step() {
+	numSteps++;
+}
+
+// --- Replay --- //
+
+void vMatchRecord::setup(vMaze * maze) {
+	// Cast, clock and viewport first, since newLevel starts from them; the carried-over actor state goes back in
+	// afterwards. The viewport places the maze in pixels, which actor movement is rounded in, so it has to match.
+	maze->setViewport(viewW, viewH);
+	maze->setPopulation(numPacmen, numGhosts);
+	maze->setTime(startTime);
+	maze->setLevel(level - 1);
+	maze->setLevelSeed(levelSeed);
+	maze->newLevel();
+	vActorTable * actors = maze->getActorTable();
+	for (int i = 0; i < actors->getSize() && i < (int)actorStarts.size(); i++) {
+		actors->state[i] = actorStarts[i].state;
+		actors->timeSeed[i] = actorStarts[i].timeSeed;
+		actors->velocity[i] = actorStarts[i].velocity;
+		actors->level[i] = actorStarts[i].level;
+		actors->wayX[i] = actorStarts[i].wayX;
+		actors->wayY[i] = actorStarts[i].wayY;
+		actors->flags[i] = (unsigned char)actorStarts[i].flags;
+		actors->mode[i] = (unsigned char)actorStarts[i].mode;
+		actors->abilityTriggered[i] = actorStarts[i].abilityTriggered;
+	}
+	if (startPaused) {
+		maze->pause();
+	} else {
+		maze->unpause();
+	}
+	nextInput = 0;
+}
+
+void vMatchRecord::apply(vMaze * maze, int s) {
+	while (nextInput < inputs.size() && inputs[nextInput].step <= s) {
+		const matchInput & in = inputs[nextInput++];
+		if (in.step < s) continue;	// Only if steps were skipped
+		switch (in.type) {
+			case MI_TURN:
+				if (in.slot >= 0 && in.slot < maze->getNumActors()) maze->turnActor(maze->getActor(in.slot), in.direction);
+				break;
+			case MI_ABILITY:
+				if (in.slot >= 0 && in.slot < maze->getNumActors()) maze->executeAbility(maze->getActor(in.slot));
+				break;
+			case MI_ROTATE_SELECTION:
+				maze->rotateSelection();
+				break;
+			case MI_PAUSE:
+				maze->pause();
+				break;
+			case MI_UNPAUSE:
+				maze->unpause();
+				break;
+		}
+	}
+}
+
+// --- Methods --- //
+
+bool vMatchRecord::load(const char * filename) {
+	FILE * f = fopen(filename, "r");
+	if (f == NULL) return false;
+	int version = 0;
+	unsigned long long seed = 0;
+	int paused = 0;
+	int numActors = 0;
+	int numInputs = 0;
+	bool ok = fscanf(f, " vengeance-match %d", &version) == 1 && version == recordVersion;
+	ok = ok && fscanf(f, " level %d", &level) == 1;
+	ok = ok && fscanf(f, " seed %llu", &seed) == 1;
+	ok = ok && fscanf(f, " population %d %d", &numPacmen, &numGhosts) == 2;
+	ok = ok && fscanf(f, " viewport %d %d", &viewW, &viewH) == 2;
+	ok = ok && fscanf(f, " step %f", &stepLength) == 1;
+	ok = ok && fscanf(f, " time %lf", &startTime) == 1;
+	ok = ok && fscanf(f, " paused %d", &paused) == 1;
+	ok = ok && fscanf(f, " actors %d", &numActors) == 1 && numActors >= 0;
+	actorStarts.clear();
+	for (int i = 0; ok && i < numActors; i++) {
+		matchActorStart a;
+		int state = 0;
+		ok = fscanf(f, " %d %f %f %d %d %d %d %d %lf", &state, &a.timeSeed, &a.velocity, &a.level, &a.wayX, &a.wayY, &a.flags, &a.mode, &a.abilityTriggered) == 9;
+		a.state = (spriteState)state;
+		actorStarts.push_back(a);
+	}
+	ok = ok && fscanf(f, " steps %d", &numSteps) == 1;
+	ok = ok && fscanf(f, " inputs %d", &numInputs) == 1 && numInputs >= 0;
+	inputs.clear();
+	for (int i = 0; ok && i < numInputs; i++) {
+		matchInput in;
+		int type = 0, direction = 0;
+		ok = fscanf(f, " %d %d %d %d", &in.step, &type, &in.slot, &direction) == 4;
+		in.type = (matchInputType)type;
+		in.direction = (MazeDirection)direction;
+		inputs.push_back(in);
+	}
+	fclose(f);
+	levelSeed = (uint64_t)seed;
+	startPaused = paused != 0;
+	nextInput = 0;
+	return ok;
+}
+
+bool vMatchRecord::save(const char * filename) {
+	// Floats and doubles are written with enough digits to read back exactly
+	FILE * f = fopen(filename, "w");
+	if (f == NULL) return false;
+	fprintf(f, "vengeance-match %d\n", recordVersion);
+	fprintf(f, "level %d\n", level);
+	fprintf(f, "seed %llu\n", (unsigned long long)levelSeed);
+	fprintf(f, "population %d %d\n", numPacmen, numGhosts);
+	fprintf(f, "viewport %d %d\n", viewW, viewH);
+	fprintf(f, "step %.9g\n", stepLength);
+	fprintf(f, "time %.17g\n", startTime);
+	fprintf(f, "paused %d\n", startPaused ? 1 : 0);
+	fprintf(f, "actors %d\n", (int)actorStarts.size());
+	for (size_t i = 0; i < actorStarts.size(); i++) {
+		const matchActorStart & a = actorStarts[i];
+		fprintf(f, "%d %.9g %.9g %d %d %d %d %d %.17g\n", (int)a.state, a.timeSeed, a.velocity, a.level, a.wayX, a.wayY, a.flags, a.mode, a.abilityTriggered);
+	}
+	fprintf(f, "steps %d\n", numSteps);
+	fprintf(f, "inputs %d\n", (int)inputs.size());
+	for (size_t i = 0; i < inputs.size(); i++) {
+		fprintf(f, "%d %d %d %d\n", inputs[i].step, (int)inputs[i].type, inputs[i].slot, (int)inputs[i].direction);
+	}
+	return fclose(f) == 0;
+}
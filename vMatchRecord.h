@@ -0,0 +1,84 @@
+/*	Brian Kirkpatrick
+	Pac-Man: Vengeance
+	Match record class
+	Begun Saturday, October 17th, 2026
+
+	The match record captures one level of play so it can be re-simulated exactly, headless: the level, its seed,
+	cast and viewport, the clock and the per-actor state that carries over from earlier levels (ability levels and
+	cooldowns, waypoints, animation phase), and then every input, stamped with the simulation step it was given
+	before. Everything else in a level follows from its seed, so replaying the inputs at the same steps through
+	vMaze::update plays the same match, tick for tick.
+
+	Records are saved as plain text, one field or input per line.
+*/
+
+#ifndef VENGEANCE_MATCH_RECORD_H
+#define VENGEANCE_MATCH_RECORD_H
+
+#include "vMaze.h"
+#include <stdint.h>
+#include <vector>
+
+enum matchInputType { MI_TURN, MI_ABILITY, MI_ROTATE_SELECTION, MI_PAUSE, MI_UNPAUSE };
+
+struct matchInput {
+	int step;		// Applied before this update, counting from 0 at the start of the level
+	matchInputType type;
+	int slot;		// MI_TURN, MI_ABILITY: actor table slot
+	MazeDirection direction;	// MI_TURN
+};
+
+// What an actor brings into the level; restored after the level is laid out
+struct matchActorStart {
+	spriteState state;
+	float timeSeed;
+	float velocity;
+	int level;
+	int wayX, wayY;		// AI waypoints are only replaced once reached, so they carry over too
+	int flags;
+	int mode;
+	double abilityTriggered;
+};
+
+class vMatchRecord {
+private:
+	// Data
+	int level;
+	uint64_t levelSeed;
+	int numPacmen, numGhosts;
+	int viewW, viewH;		// Viewport the maze was laid out in; replays simulate in it whatever size they draw at
+	float stepLength;		// Seconds per update
+	double startTime;		// Maze clock when the level began
+	bool startPaused;
+	int numSteps;			// Updates recorded so far
+	size_t nextInput;		// Replay position
+	std::vector<matchActorStart> actorStarts;
+	std::vector<matchInput> inputs;
+protected:
+public:
+	// Constructors
+	vMatchRecord();
+	~vMatchRecord();
+
+	// Accessors
+	int getLevel();
+	uint64_t getLevelSeed();
+	int getNumInputs();
+	int getNumSteps();
+	float getStepLength();
+
+	// Recording
+	void begin(vMaze * maze, float dt);		// Call once the level is laid out, before its first update
+	void addInput(matchInputType type, int slot=-1, MazeDirection direction=MD_NONE);
+	void step();							// Call after each update
+
+	// Replay
+	void setup(vMaze * maze);				// Lays the recorded level out in maze, as it stood when recording began
+	void apply(vMaze * maze, int s);		// Gives the inputs recorded before update s; call with s = 0, 1, 2...
+
+	// Methods
+	bool load(const char * filename);
+	bool save(const char * filename);
+};
+
+#endif
@@ -3,20 +3,28 @@
 	Maze class
 	Begun Monday, May 3rd, 2010
 
-	The mazeSquare struct defines wall layouts for each square in the maze
+	The mazeSquare struct is a read-only snapshot of the walls and flags around one square in the maze
 
 	The vMaze class defines a maze and many maze-specific mechanics for the game. The maze class includes maze layout
-	(a matrix of mazeSquare objects), maze generation methods, actor instances (ghosts and pacman), items, etc.
+	(bit grids of shared walls and per-square flags), maze generation methods, actor instances (ghosts and pacman),
+	items, etc. It has no graphics dependencies, so whole levels can be simulated headless; see vRenderer for drawing.
 */
 
 #include "vMaze.h"
+#include "vRouteTable.h"
 #include "Dice.h"
+#include "DisjointSet.h"
+#include "BitGrid.h"
+#include "vFlood.h"
+#include "vTimerWheel.h"
+#include "vActorGrid.h"
 #include <math.h>
-#include <time.h>
+#include <stdlib.h>
 
 // --- mazeSquare --- //
 
 mazeSquare::mazeSquare() {
+	// Squares outside the maze are walled in on all sides
 	wallUp = true;
 	wallDown = true;
 	wallLeft = true;
@@ -25,15 +33,6 @@ mazeSquare::mazeSquare() {
 	accessible = false;
 }
 
-void mazeSquare::reset(bool empty) {
-	wallUp = !empty;
-	wallDown = !empty;
-	wallLeft = !empty;
-	wallRight = !empty;
-	visited = false;
-	accessible = false;
-}
-
 // --- vMaze --- //
 
 // --- Constructors --- //
@@ -47,6 +46,7 @@ vMaze::vMaze() {
 	level = 0;
 	levelPoints = 0;
 	vulnerabilityDuration = 3.0;
+	simTime = 0.0;
 	minW = 5.0f;
 	minH = 7.0f;
 	maxW = 13.0f;
@@ -54,55 +54,43 @@ vMaze::vMaze() {
 	fruitDensity = 1.0f / 10.0f;
 	levelScaleSpeed = 0.05f;
 	squareDim = 40.0f;
+	algorithm = MA_DIVISION;
 
-	// Load maze textures
-	textures = new aTexture();
-	textures->loadFromFile("..\\resources\\textures.png");
+	// Screen coordinates are laid out for the game window until told otherwise
+	viewW = 870;
+	viewH = 675;
 
 	// Initialize objects
-	squares = NULL;
+	vertWalls = new BitGrid();
+	horizWalls = new BitGrid();
+	visitedFlags = new BitGrid();
+	accessibleFlags = new BitGrid();
+	reachFlags = new BitGrid();
+	flood = new vFlood();
+	distances = NULL;
+	dangerField = NULL;
+	preyField = NULL;
+	dangerStale = preyStale = true;
+	searchStamp = 0;
+	for (int i = 0; i < numItemTypes; i++) {
+		itemWeights[i] = 1.0f;
+	}
+	regions = new DisjointSet();
+	routes = new vRouteTable();
+	timers = new vTimerWheel(0.01);
+	vulnerabilityTimer = -1;
 	die = new Dice();
-	items = NULL;
-
-	// Initialize Pacman sprite
-	pacman = new vActor();
-	pacman->setTexture(textures);
-	pacman->setType(V_PACMAN);
-	pacman->setMode(AI_GREEDY);
-
-	// Initialize ghost sprites
-	blinky = new vActor();
-	blinky->setTexture(textures);
-	blinky->setType(V_RED_G);
-	blinky->setState(SS_UP2);
-
-	pinky = new vActor();
-	pinky->setTexture(textures);
-	pinky->setType(V_PINK_G);
-	pinky->setState(SS_LEFT2);
-
-	inky = new vActor();
-	inky->setTexture(textures);
-	inky->setType(V_BLUE_G);
-	inky->setState(SS_DOWN2);
-
-	clyde = new vActor();
-	clyde->setTexture(textures);
-	clyde->setType(V_ORANGE_G);
-	clyde->setState(SS_RIGHT2);
-
-	// Set ghost locations
-	moveToMazeXY(blinky, numW / 2, numH / 2 - 1);
-	moveToMazeXY(pinky, numW / 2 - 1, numH / 2);
-	moveToMazeXY(inky, numW / 2 + 1, numH / 2);
-	moveToMazeXY(clyde, numW / 2, numH / 2);
-
-	// Load wall sprite
-	wallSegment = new vSprite(textures);
-	wallSegment->setType(V_WALLS);
-	wallSegment->setW(squareDim);
-	wallSegment->setH(squareDim);
-	wallSegment->isTranslucent = true;
+	levelSeed = 0;
+	hasLevelSeed = false;
+	layoutStamp = 0;
+	items = new vItemGrid();
+
+	// Default cast: pacman and the four ghosts
+	actors = new vActorTable();
+	pacmanCells = new vActorGrid();
+	ghostCells = new vActorGrid();
+	pacman = blinky = pinky = inky = clyde = NULL;
+	setPopulation(1, 4);
 
 	// Initialize states to false
 	numEffects = 8;
@@ -113,60 +101,103 @@ vMaze::vMaze() {
 
 vMaze::~vMaze() {
 	// Lots of stuff to destroy! (if not null)
-	if (squares != NULL) {
-		delete[] squares;
-		squares = NULL;
+	if (vertWalls != NULL) {
+		delete vertWalls;
+		vertWalls = NULL;
+	}
+	if (horizWalls != NULL) {
+		delete horizWalls;
+		horizWalls = NULL;
+	}
+	if (visitedFlags != NULL) {
+		delete visitedFlags;
+		visitedFlags = NULL;
+	}
+	if (accessibleFlags != NULL) {
+		delete accessibleFlags;
+		accessibleFlags = NULL;
+	}
+	if (reachFlags != NULL) {
+		delete reachFlags;
+		reachFlags = NULL;
+	}
+	if (flood != NULL) {
+		delete flood;
+		flood = NULL;
+	}
+	if (distances != NULL) {
+		delete[] distances;
+		distances = NULL;
+	}
+	if (dangerField != NULL) {
+		delete[] dangerField;
+		dangerField = NULL;
+	}
+	if (preyField != NULL) {
+		delete[] preyField;
+		preyField = NULL;
+	}
+	if (regions != NULL) {
+		delete regions;
+		regions = NULL;
+	}
+	if (routes != NULL) {
+		delete routes;
+		routes = NULL;
+	}
+	if (timers != NULL) {
+		delete timers;
+		timers = NULL;
 	}
 	if (die != NULL) {
 		delete die;
 		die = NULL;
 	}
 	if (items != NULL) {
-		delete[] items;
+		delete items;
 		items = NULL;
 	}
-	if (textures != NULL) {
-		delete textures;
-		textures = NULL;
-	}
-	if (wallSegment != NULL) {
-		delete wallSegment;
-		wallSegment = NULL;
-	}
 	if (soundFlags != NULL) {
 		delete[] soundFlags;
 		soundFlags = NULL;
 	}
+	releaseActors();
+	if (actors != NULL) {
+		delete actors;
+		actors = NULL;
+	}
+	if (pacmanCells != NULL) {
+		delete pacmanCells;
+		pacmanCells = NULL;
+	}
+	if (ghostCells != NULL) {
+		delete ghostCells;
+		ghostCells = NULL;
+	}
 }
 
 // --- Private Methods --- //
 
 void vMaze::applyAi(vActor * actor) {
 	// Apply AI to determine actor's actions
-	// Make sure border walls are set
-	setVertWall(0);
-	setVertWall(numW);
-	setHorizWall(0);
-	setHorizWall(numH);
-
 	// enum AiObjective { AI_NONE, AI_AVOID, AI_HOMICIDAL, AI_GREEDY, AI_RANDOM };
-	int cx = screenX2mazeX((int)(actor->getX().value));
-	int cy = screenY2mazeY((int)(actor->getY().value));
+	int cx = screenX2mazeX((int)(actor->getX()));
+	int cy = screenY2mazeY((int)(actor->getY()));
 	int destX = numW / 2;
 	int destY = numH / 2;
-	int distanceToItem = numW + numH;
-	vItem * toSeek = NULL;
-	bool isGhost = !(actor == pacman);
+	int seekX = -1;
+	int seekY = -1;
+	bool isGhost = actor->getType() != V_PACMAN;
 
 	// If we're still moving into a square, we don't need to recalculate path yet
 	if (actor->getVelY() > 0) {
-		if (mazeY2screenY(cy) > actor->getY().value) return;
+		if (mazeY2screenY(cy) > actor->getY()) return;
 	} else if (actor->getVelX() < 0) {
-		if (mazeX2screenX(cx) < actor->getX().value) return;
+		if (mazeX2screenX(cx) < actor->getX()) return;
 	} else if (actor->getVelY() < 0) {
-		if (mazeY2screenY(cy) < actor->getY().value) return;
+		if (mazeY2screenY(cy) < actor->getY()) return;
 	} else if (actor->getVelX() > 0) {
-		if (mazeX2screenX(cx) > actor->getX().value) return;
+		if (mazeX2screenX(cx) > actor->getX()) return;
 	}
 
 	// AI mode determines path selection
@@ -176,73 +207,19 @@ void vMaze::applyAi(vActor * actor) {
 			actor->setWaypoint(cx, cy);
 			break;
 		case AI_AVOID:
-			// If waypoint reached, new waypoint away from nearest enemy actor
-			if (cx == actor->getWayX() && cy == actor->getWayY()) {
-				int destX = numW / 2;
-				int destY = numH / 2;
-				if (isGhost) {
-					int pacX = screenX2mazeX((int)(pacman->getX().value));
-					int pacY = screenY2mazeY((int)(pacman->getY().value));
-					destX = 2 * cx - pacX;
-					destY = 2 * cy - pacY;
-					if (destX < 0) destX = 0;
-					if (destX >= numW) destX = numW-1;
-					if (destY < 0) destY = 0;
-					if (destY >= numH) destY = numH-1;
-					actor->setWaypoint(destX, destY);
-				} else {
-					int distToBlinky = (screenX2mazeX((int)(blinky->getX().value)) - cx) * (screenX2mazeX((int)(blinky->getX().value)) - cx) + (screenY2mazeY((int)(blinky->getY().value)) - cy) * (screenY2mazeY((int)(blinky->getY().value)) - cy);
-					int distToPinky = (screenX2mazeX((int)(pinky->getX().value)) - cx) * (screenX2mazeX((int)(pinky->getX().value)) - cx) + (screenY2mazeY((int)(pinky->getY().value)) - cy) * (screenY2mazeY((int)(pinky->getY().value)) - cy);
-					int distToInky = (screenX2mazeX((int)(inky->getX().value)) - cx) * (screenX2mazeX((int)(inky->getX().value)) - cx) + (screenY2mazeY((int)(inky->getY().value)) - cy) * (screenY2mazeY((int)(inky->getY().value)) - cy);
-					int distToClyde = (screenX2mazeX((int)(clyde->getX().value)) - cx) * (screenX2mazeX((int)(clyde->getX().value)) - cx) + (screenY2mazeY((int)(clyde->getY().value)) - cy) * (screenY2mazeY((int)(clyde->getY().value)) - cy);
-					vActor * fleeFrom = NULL;
-					if (distToBlinky <= distToPinky && distToBlinky <= distToInky && distToBlinky <= distToClyde) {
-						fleeFrom = blinky;
-					} else if (distToPinky <= distToInky && distToPinky <= distToClyde) {
-						fleeFrom = pinky;
-					} else if (distToInky <= distToClyde) {
-						fleeFrom = inky;
-					} else {
-						fleeFrom = clyde;
-					}
-					int fleeX = screenX2mazeX((int)(fleeFrom->getX().value));
-					int fleeY = screenY2mazeY((int)(fleeFrom->getY().value));
-					destX = 2 * cx - fleeX;
-					destY = 2 * cy - fleeY;
-				}
-				if (destX < 0) destX = 0;
-				if (destX >= numW) destX = numW-1;
-				if (destY < 0) destY = 0;
-				if (destY >= numH) destY = numH-1;
-				actor->setWaypoint(destX, destY);
+			// If waypoint reached, new waypoint as far from the enemy (by maze distance) as can safely be had
+			if ((cx == actor->getWayX() && cy == actor->getWayY()) || actor->getWayX() == -1 || actor->getWayY() == -1) {
+				chooseRefuge(actor, cx, cy, isGhost ? getPreyField() : getDangerField());
 			}
 			break;
 		case AI_HOMICIDAL:
 			// Target nearest, um, target!
-			if (isGhost) {
-				destX = screenX2mazeX((int)(pacman->getX().value));
-				destY = screenY2mazeY((int)(pacman->getY().value));
-			} else {
-				int distToBlinky = (screenX2mazeX((int)(blinky->getX().value)) - cx) * (screenX2mazeX((int)(blinky->getX().value)) - cx) + (screenY2mazeY((int)(blinky->getY().value)) - cy) * (screenY2mazeY((int)(blinky->getY().value)) - cy);
-				int distToPinky = (screenX2mazeX((int)(pinky->getX().value)) - cx) * (screenX2mazeX((int)(pinky->getX().value)) - cx) + (screenY2mazeY((int)(pinky->getY().value)) - cy) * (screenY2mazeY((int)(pinky->getY().value)) - cy);
-				int distToInky = (screenX2mazeX((int)(inky->getX().value)) - cx) * (screenX2mazeX((int)(inky->getX().value)) - cx) + (screenY2mazeY((int)(inky->getY().value)) - cy) * (screenY2mazeY((int)(inky->getY().value)) - cy);
-				int distToClyde = (screenX2mazeX((int)(clyde->getX().value)) - cx) * (screenX2mazeX((int)(clyde->getX().value)) - cx) + (screenY2mazeY((int)(clyde->getY().value)) - cy) * (screenY2mazeY((int)(clyde->getY().value)) - cy);
-				if (!blinky->getIsAlive()) distToBlinky = numH * numW;
-				if (!pinky->getIsAlive()) distToPinky = numH * numW;
-				if (!inky->getIsAlive()) distToInky = numH * numW;
-				if (!clyde->getIsAlive()) distToClyde = numH * numW;
-				vActor * seekTo = NULL;
-				if (distToBlinky <= distToPinky && distToBlinky <= distToInky && distToBlinky <= distToClyde) {
-					seekTo = blinky;
-				} else if (distToPinky <= distToInky && distToPinky <= distToClyde) {
-					seekTo = pinky;
-				} else if (distToInky <= distToClyde) {
-					seekTo = inky;
-				} else {
-					seekTo = clyde;
+			{
+				vActor * seekTo = findNearest(cx, cy, !isGhost);
+				if (seekTo != NULL) {
+					destX = screenX2mazeX((int)(seekTo->getX()));
+					destY = screenY2mazeY((int)(seekTo->getY()));
 				}
-				destX = screenX2mazeX((int)(seekTo->getX().value));
-				destY = screenY2mazeY((int)(seekTo->getY().value));
 			}
 			if (destX < 0) destX = 0;
 			if (destX >= numW) destX = numW-1;
@@ -251,19 +228,11 @@ void vMaze::applyAi(vActor * actor) {
 			actor->setWaypoint(destX, destY);
 			break;
 		case AI_GREEDY:
-			// Seek nearest item
+			// Seek nearest reachable item (weighted by type)
 			if ((cx == actor->getWayX() && cy == actor->getWayY()) || actor->getWayX() == -1 || actor->getWayY() == -1) {
-				for (int i = 0; i < numW; i++) {
-					for (int j = 0; j < numH; j++) {
-						int distanceToHere = (cx - i) * (cx - i) + (cy - j) * (cy - j);
-						if (!items[i * numH + j].getIsConsumed() && distanceToHere < distanceToItem) {
-							distanceToItem = distanceToHere;
-							toSeek = &items[i * numH + j];
-						}
-					}
-				}
-				if (toSeek != NULL) {
-					actor->setWaypoint(screenX2mazeX((int)(toSeek->getX().value)), screenY2mazeY((int)(toSeek->getY().value)));
+				if (findItem(cx, cy, &seekX, &seekY)) {
+					// Item squares come straight from the grid; item screen positions are only set when drawn
+					actor->setWaypoint(seekX, seekY);
 				} else {
 					actor->setWaypoint(0, 0);
 				}
@@ -273,135 +242,79 @@ void vMaze::applyAi(vActor * actor) {
 		default:
 			// Choose a random square, if we've already reached the current one
 			if ((cx == actor->getWayX() && cy == actor->getWayY()) || actor->getWayX() == -1 || actor->getWayY() == -1) {
-				Dice die = Dice();
-				int x = die.rollInt(numW);
-				int y = die.rollInt(numH);
+				int x = die->rollInt(numW);
+				int y = die->rollInt(numH);
 				actor->setWaypoint(x, y);
 			}
 			break;
 	}
 
 	// We have a waypoint; determine a pathway and turn actor to reach first step
-	// Use partial A*: plot distance from destination point to current point recursively
+	// Use the route table if one was built for this maze; otherwise plot distances from the destination point
 	int currX = actor->getWayX(); int currY = actor->getWayY();
-	int * stepsToDest = new int[numW * numH];
-	for (int i = 0; i < numW * numH; i++) {
-		stepsToDest[i] = -1;
+	MazeDirection step = MD_NONE;
+	if (actor->getMode() == AI_HOMICIDAL && cx >= 0 && cx < numW && cy >= 0 && cy < numH) {
+		// Hunting goes straight down the shared field, which leads to the nearest living enemy by a shortest path
+		int * field = isGhost ? getPreyField() : getDangerField();
+		if (field[cx * numH + cy] > 0) step = stepTowards(field, cx, cy);
+	} else if (routes->getIsBuilt()) {
+		step = routes->getHop(cx, cy, currX, currY);
+	} else if (currX >= 0 && currX < numW && currY >= 0 && currY < numH) {
+		for (int i = 0; i < numW * numH; i++) {
+			distances[i] = -1;
+		}
+		distances[currX * numH + currY] = 0;
+		aStarPlot(distances, currX, currY);
+		step = stepTowards(distances, cx, cy);
 	}
-	stepsToDest[currX * numH + currY] = 0;
-	aStarPlot(stepsToDest, currX, currY);
-
-	// Check path distances to each side
-	int up = cy < numH-1 ? stepsToDest[cx * numH + cy+1] : numW & numH;
-	int left = cx > 0 ? stepsToDest[(cx-1) * numH + cy] : numW * numH;
-	int down = cy > 0 ? stepsToDest[cx * numH + cy-1] : numW * numH;
-	int right = cx < numW-1 ? stepsToDest[(cx+1) * numH + cy] : numW * numH;
-
-	// Enforce bounds
-	up = up == -1 ? numW * numH : up;
-	left = left == -1 ? numW * numH : left;
-	down = down == -1 ? numW * numH : down;
-	right = right == -1 ? numW * numH : right;
-	mazeSquare * currSquare = getSquare(cx, cy);
-	if (up < 0 || up > numW * numH || currSquare->wallUp) up = numW * numH;;
-	if (left < 0 || left > numW * numH || currSquare->wallLeft) left = numW * numH;;
-	if (down < 0 || down > numW * numH || currSquare->wallDown) down = numW * numH;;
-	if (right < 0 || right > numW * numH || currSquare->wallRight) right = numW * numH;;
 
 	// Enact movement
 	if (cx == currX && cy == currY) {
 		// Continue moving through this square
-	} else if (up <= left && up <= down && up <= right && !currSquare->wallUp && up >= 0) {
-		turnActor(actor, MD_UP);
-	} else if (left <= down && left <= right && !currSquare->wallLeft && left >= 0) {
-		turnActor(actor, MD_LEFT);
-	} else if (down <= right && !currSquare->wallDown && down >= 0) {
-		turnActor(actor, MD_DOWN);
-	} else if (!currSquare->wallRight && right >= 0) {
-		turnActor(actor, MD_RIGHT);
-	} else {
+	} else if (step != MD_NONE) {
+		turnActor(actor, step);
 	}
-	delete[] stepsToDest;
 }
 
-void vMaze::breakIsolation(int x, int y) {
+void vMaze::breakIsolation() {
 	// Ensure all cells are connected to the center
-	mazeSquare * current = NULL;
+	// Regions start out as the areas enclosed by the generated walls; every wall knocked out below merges two of them
 	int centerX = numW / 2;
 	int centerY = numH / 2;
-	if (x == -1 && y == -1) {
-		// At beginning, which by definition is not isloated. Check each cell in the maze.
-		for (int i = 0; i < numW; i++) {
-			for (int j = 0; j < numH; j++) {
-				current = getSquare(i, j);
-				if (!current->accessible) {
-					current->visited = true;
-					breakIsolation(i, j);
-				}
-			}
+	int town = centerX * numH + centerY;
+	regions->reset(numW * numH);
+	for (int i = 0; i < numW; i++) {
+		for (int j = 0; j < numH; j++) {
+			if (j < numH-1 && !getWall(i, j, MD_UP)) regions->merge(i * numH + j, i * numH + j+1);
+			if (i < numW-1 && !getWall(i, j, MD_RIGHT)) regions->merge(i * numH + j, (i+1) * numH + j);
 		}
-	} else if (getSquare(x, y)->accessible) {
-		// Already accessible; ignore
-	} else {
-		current = getSquare(x, y);
-		current->visited = true;
-		bool tried0 = y >= numH-1 || (y == centerY-1 && x >= centerX-1 && x <= centerX+1) || getSquare(x, y+1)->visited;
-		bool tried1 = x <= 0 || (x == centerX+2 && y == centerY) || getSquare(x-1, y)->visited;
-		bool tried2 = y <= 0 || (y == centerY+1 && x >= centerX-1 && x <= centerX+1) || getSquare(x, y-1)->visited;
-		bool tried3 = x >= numW-1 || (x == centerX-2 && y == centerY) || getSquare(x+1, y)->visited;
-		while (!current->accessible || !(tried0 && tried1 && tried2 && tried3)) {
-			// Try breaking through to a random neighbor
-			int breakDirection = die->rollInt(4);
-			switch (breakDirection) {
-				case 0:
-					// Break up, if not at top or already visited, or below ghost town
-					if (!tried0) {
-						setHorizWall(x, y+1, false);
-						refreshAccessibility();
-						if (!current->accessible) {
-							breakIsolation(x, y+1);
-						}
-						tried0 = true;
-					}
-					break;
-				case 1:
-					// Break left, if not at edge or already broken, or right of ghost town
-					if (!tried1) {
-						setVertWall(x, y, false);
-						refreshAccessibility();
-						if (!current->accessible) {
-							breakIsolation(x-1, y);
-						}
-						tried1 = true;
-					}
-					break;
-				case 2:
-					// Break down, if not at bottom or already broken, or above ghost town
-					if (!tried2) {
-						setHorizWall(x, y, false);
-						refreshAccessibility();
-						if (!current->accessible) {
-							breakIsolation(x, y-1);
-						}
-						tried2 = true;
-					}
-					break;
-				case 3:
-				default:
-					// Break right, if not at edge or already broken, or left of ghost town
-					if (!tried3) {
-						setVertWall(x+1, y, false);
-						refreshAccessibility();
-						if (!current->accessible) {
-							breakIsolation(x+1, y);
-						}
-						tried3 = true;
-					}
-					break;
+	}
+
+	// Isolated squares break through to a random neighbor in another region, until they reach the center. A square
+	// whose neighbors all share its region is skipped; one on the edge of that region will connect it, possibly on a
+	// later pass.
+	bool changed = true;
+	int candidates[4];
+	while (changed) {
+		changed = false;
+		for (int x = 0; x < numW; x++) {
+			for (int y = 0; y < numH; y++) {
+				int n = x * numH + y;
+				while (!regions->isJoined(n, town)) {
+					// Never break through the border, or into the sides of ghost town
+					int numCandidates = 0;
+					if (y < numH-1 && !(y == centerY-1 && x >= centerX-1 && x <= centerX+1) && !regions->isJoined(n, n+1)) candidates[numCandidates++] = MD_UP;
+					if (x > 0 && !(x == centerX+2 && y == centerY) && !regions->isJoined(n, n-numH)) candidates[numCandidates++] = MD_LEFT;
+					if (y > 0 && !(y == centerY+1 && x >= centerX-1 && x <= centerX+1) && !regions->isJoined(n, n-1)) candidates[numCandidates++] = MD_DOWN;
+					if (x < numW-1 && !(x == centerX-2 && y == centerY) && !regions->isJoined(n, n+numH)) candidates[numCandidates++] = MD_RIGHT;
+					if (numCandidates == 0) break;
+					openWall(x, y, (MazeDirection)candidates[die->rollInt(numCandidates)]);
+					changed = true;
+				}
 			}
 		}
 	}
-	current = NULL;
+	refreshAccessibility();
 }
 
 void vMaze::buildGhostTown() {
@@ -431,14 +344,36 @@ void vMaze::buildGhostTown() {
 	setVertWall(centerX+1, centerY-1, false);
 
 	// These squares are accessible, by definition
-	mazeSquare * current = getSquare(centerX, centerY);
-	current->accessible = true;
-	current = getSquare(centerX-1, centerY);
-	current->accessible = true;
-	current = getSquare(centerX+1, centerY);
-	current->accessible = true;
-	current = getSquare(centerX, centerY-1);
-	current->accessible = true;
+	accessibleFlags->set(centerX, centerY);
+	accessibleFlags->set(centerX-1, centerY);
+	accessibleFlags->set(centerX+1, centerY);
+	accessibleFlags->set(centerX, centerY-1);
+}
+
+void vMaze::chooseRefuge(vActor * actor, int cx, int cy, int * threat) {
+	// Of the squares we can reach before any threat can, the one furthest from all of them; failing that, the one
+	// furthest away regardless. With no threats about, head for the middle.
+	if (cx < 0 || cx >= numW || cy < 0 || cy >= numH) return;
+	for (int i = 0; i < numW * numH; i++) {
+		distances[i] = -1;
+	}
+	distances[cx * numH + cy] = 0;
+	aStarPlot(distances, cx, cy);
+	int best = -1;
+	bool bestIsSafe = false;
+	for (int i = 0; i < numW * numH; i++) {
+		if (distances[i] < 0 || threat[i] < 0) continue;
+		bool isSafe = distances[i] < threat[i];
+		if (best == -1 || (isSafe && !bestIsSafe) || (isSafe == bestIsSafe && threat[i] > threat[best])) {
+			best = i;
+			bestIsSafe = isSafe;
+		}
+	}
+	if (best == -1) {
+		actor->setWaypoint(numW / 2, numH / 2);
+	} else {
+		actor->setWaypoint(best / numH, best % numH);
+	}
 }
 
 void vMaze::divisionStep(int l, int r, int b, int t) {
@@ -480,15 +415,39 @@ void vMaze::divisionStep(int l, int r, int b, int t) {
 	divisionStep(vWall, r, hWall, t);
 }
 
+void vMaze::endImmunity(void * owner, void * subject) {
+	// Immunity is over; rejoin the other ghosts' vulnerability, if it's still going
+	vMaze * maze = (vMaze *)owner;
+	vActor * ghost = (vActor *)subject;
+	maze->actors->abilityTimer[ghost->getSlot()] = -1;
+	ghost->setScared(maze->vulnerabilityTimer != -1);
+}
+
+void vMaze::endSprint(void * owner, void * subject) {
+	// Back to normal ghost speed (from the next turn on)
+	vMaze * maze = (vMaze *)owner;
+	vActor * ghost = (vActor *)subject;
+	maze->actors->abilityTimer[ghost->getSlot()] = -1;
+	ghost->setVelocity(0.8f * baseVelocity);
+}
+
+void vMaze::endVulnerability(void * owner, void *) {
+	vMaze * maze = (vMaze *)owner;
+	maze->vulnerabilityTimer = -1;
+	for (size_t i = 0; i < maze->ghosts.size(); i++) {
+		maze->ghosts[i]->setScared(false);
+	}
+	for (size_t i = 0; i < maze->pacmen.size(); i++) {
+		maze->pacmen[i]->setMode(AI_GREEDY);
+	}
+}
+
 void vMaze::fillSpaces() {
 	// Checks for empty spaces (intersections of all non-walls) and fills them with one wall
-	mazeSquare * q1 = NULL;
-	mazeSquare * q3 = NULL;
+	// Intersection i,j is the lower left corner of square i,j; its four arms are the walls that meet there
 	for (int i = 1; i < numW; i++) {
 		for (int j = 1; j < numH; j++) {
-			q1 = getSquare(i, j);
-			q3 = getSquare(i-1, j-1);
-			if (!q1->wallLeft && !q1->wallDown && !q3->wallUp && !q3->wallRight) {
+			if (!vertWalls->get(i, j) && !horizWalls->get(i, j) && !vertWalls->get(i, j-1) && !horizWalls->get(i-1, j)) {
 				int wallToFill = die->rollInt(4);
 				switch (wallToFill) {
 					case 0:
@@ -515,20 +474,224 @@ void vMaze::fillSpaces() {
 }
 
 void vMaze::generate(MazeAlg algorithm) {
-	resetSquares();
 	switch (algorithm) {
+		case MA_PRIM:
+		case MA_KRUSKAL:
+		case MA_BACKTRACK:
+			// Spanning-tree algorithms carve passages out of a solid maze, skipping the ghost town row; ghost town
+			// then joins the tree through its entrance, so every square is connected by construction
+			resetSquares(false);
+			regions->reset(numW * numH);
+			if (algorithm == MA_PRIM) {
+				primCarve();
+			} else if (algorithm == MA_KRUSKAL) {
+				kruskalCarve();
+			} else {
+				backtrackCarve();
+			}
+			buildGhostTown();
+			accessibleFlags->fill(true);
+			fillSpaces();
+			break;
 		case MA_DIVISION:
+		default:
+			resetSquares();
 			divisionStep(0, numW, 0, numH);
 			buildGhostTown();
-			refreshAccessibility();
 			breakIsolation();
 			fillSpaces();
 			break;
+	}
+
+	// Carving can open the border; it is closed here once, so ticks never have to touch the layout
+	setVertWall(0);
+	setVertWall(numW);
+	setHorizWall(0);
+	setHorizWall(numH);
+}
+
+bool vMaze::isGhostTown(int x, int y) {
+	// True for the three squares of the ghost town row, which the spanning-tree algorithms leave alone
+	return y == numH / 2 && x >= numW / 2 - 1 && x <= numW / 2 + 1;
+}
+
+void vMaze::locateActors() {
+	// Every actor's square is refreshed, but only actors that changed squares (or lived or died) touch the grids
+	int numActors = actors->getSize();
+	int numPacmen = (int)pacmen.size();
+	for (int i = 0; i < numActors; i++) {
+		int mx = screenX2mazeX((int)actors->x[i]);
+		int my = screenY2mazeY((int)actors->y[i]);
+		actors->cellX[i] = mx;
+		actors->cellY[i] = my;
+		vActorGrid * grid = i < numPacmen ? pacmanCells : ghostCells;
+		if ((actors->flags[i] & AF_ALIVE) && mx >= 0 && mx < numW && my >= 0 && my < numH) {
+			grid->place(i, mx, my);
+		} else {
+			grid->remove(i);
+		}
+	}
+	dangerStale = preyStale = true;
+}
+
+void vMaze::openWall(int x, int y, MazeDirection direction) {
+	// Removes the wall on the given side of square x,y, merging the regions on either side
+	int n = x * numH + y;
+	switch (direction) {
+		case MD_UP:
+			setHorizWall(x, y+1, false);
+			regions->merge(n, n+1);
+			break;
+		case MD_LEFT:
+			setVertWall(x, y, false);
+			regions->merge(n, n-numH);
+			break;
+		case MD_DOWN:
+			setHorizWall(x, y, false);
+			regions->merge(n, n-1);
+			break;
+		case MD_RIGHT:
+			setVertWall(x+1, y, false);
+			regions->merge(n, n+numH);
+			break;
 		default:
 			break;
 	}
 }
 
+void vMaze::backtrackCarve() {
+	// Recursive backtracker, with an explicit stack of square indices in place of recursion
+	int numSquares = numW * numH;
+	int * stack = new int[numSquares];
+	int depth = 0;
+	int candidates[4];
+	resetVisited();
+	for (int i = numW / 2 - 1; i <= numW / 2 + 1; i++) {
+		visitedFlags->set(i, numH / 2);
+	}
+
+	// Start from the ghost town entrance
+	int start = (numW / 2) * numH + numH / 2 - 1;
+	visitedFlags->set(start / numH, start % numH);
+	stack[depth++] = start;
+	while (depth > 0) {
+		int n = stack[depth-1];
+		int x = n / numH;
+		int y = n % numH;
+
+		// Gather unvisited neighbors (as directions)
+		int numCandidates = 0;
+		if (y < numH-1 && !visitedFlags->get(x, y+1)) candidates[numCandidates++] = MD_UP;
+		if (x > 0 && !visitedFlags->get(x-1, y)) candidates[numCandidates++] = MD_LEFT;
+		if (y > 0 && !visitedFlags->get(x, y-1)) candidates[numCandidates++] = MD_DOWN;
+		if (x < numW-1 && !visitedFlags->get(x+1, y)) candidates[numCandidates++] = MD_RIGHT;
+		if (numCandidates == 0) {
+			// Dead end; back up
+			depth--;
+			continue;
+		}
+
+		// Carve into a random neighbor and continue from there
+		MazeDirection d = (MazeDirection)candidates[die->rollInt(numCandidates)];
+		openWall(x, y, d);
+		int next = d == MD_UP ? n+1 : d == MD_LEFT ? n-numH : d == MD_DOWN ? n-1 : n+numH;
+		visitedFlags->set(next / numH, next % numH);
+		stack[depth++] = next;
+	}
+	delete[] stack;
+}
+
+void vMaze::kruskalCarve() {
+	// Randomized Kruskal: shuffle every interior wall, then remove each one that joins two separate regions
+	int numSquares = numW * numH;
+	int * edges = new int[2 * numSquares];	// Square index * 2, plus 0 for its right wall or 1 for its upper wall
+	int numEdges = 0;
+	for (int i = 0; i < numW; i++) {
+		for (int j = 0; j < numH; j++) {
+			if (isGhostTown(i, j)) continue;
+			if (i < numW-1 && !isGhostTown(i+1, j)) edges[numEdges++] = 2 * (i * numH + j);
+			if (j < numH-1 && !isGhostTown(i, j+1)) edges[numEdges++] = 2 * (i * numH + j) + 1;
+		}
+	}
+
+	// Fisher-Yates shuffle
+	for (int i = numEdges - 1; i > 0; i--) {
+		int k = die->rollInt(i + 1);
+		int swap = edges[i]; edges[i] = edges[k]; edges[k] = swap;
+	}
+
+	for (int i = 0; i < numEdges; i++) {
+		int n = edges[i] / 2;
+		bool isUp = edges[i] % 2 == 1;
+		if (!regions->isJoined(n, isUp ? n+1 : n+numH)) {
+			openWall(n / numH, n % numH, isUp ? MD_UP : MD_RIGHT);
+		}
+	}
+	delete[] edges;
+}
+
+void vMaze::placeGhost(int k) {
+	// The first four ghosts start around the middle of the maze; every further group of four one square further out
+	static const int startX[4] = { 0, -1, 1, 0 };
+	static const int startY[4] = { -1, 0, 0, 0 };
+	static const int ringX[4] = { 0, -1, 1, 0 };
+	static const int ringY[4] = { -1, 0, 0, 1 };
+	int ring = k / 4;
+	int x = numW / 2 + startX[k % 4] + ringX[k % 4] * ring;
+	int y = numH / 2 + startY[k % 4] + ringY[k % 4] * ring;
+	if (x < 0) x = 0;
+	if (x >= numW) x = numW-1;
+	if (y < 0) y = 0;
+	if (y >= numH) y = numH-1;
+	moveToMazeXY(ghosts[k], x, y);
+}
+
+void vMaze::primCarve() {
+	// Randomized Prim: grow from the ghost town entrance, adding a random frontier square to the maze each step
+	int numSquares = numW * numH;
+	int * frontierList = new int[numSquares];
+	bool * queued = new bool[numSquares];
+	int numFrontier = 0;
+	int candidates[4];
+	for (int i = 0; i < numSquares; i++) {
+		queued[i] = false;
+	}
+	resetVisited();
+	for (int i = numW / 2 - 1; i <= numW / 2 + 1; i++) {
+		visitedFlags->set(i, numH / 2);
+	}
+
+	int n = (numW / 2) * numH + numH / 2 - 1;
+	queued[n] = true;
+	while (true) {
+		int x = n / numH;
+		int y = n % numH;
+		visitedFlags->set(x, y);
+
+		// Queue unvisited neighbors
+		if (y < numH-1 && !queued[n+1] && !visitedFlags->get(x, y+1)) { queued[n+1] = true; frontierList[numFrontier++] = n+1; }
+		if (x > 0 && !queued[n-numH] && !visitedFlags->get(x-1, y)) { queued[n-numH] = true; frontierList[numFrontier++] = n-numH; }
+		if (y > 0 && !queued[n-1] && !visitedFlags->get(x, y-1)) { queued[n-1] = true; frontierList[numFrontier++] = n-1; }
+		if (x < numW-1 && !queued[n+numH] && !visitedFlags->get(x+1, y)) { queued[n+numH] = true; frontierList[numFrontier++] = n+numH; }
+		if (numFrontier == 0) break;
+
+		// Pull a random frontier square (swap-remove), and connect it to a random neighbor already in the maze
+		int k = die->rollInt(numFrontier);
+		n = frontierList[k];
+		frontierList[k] = frontierList[--numFrontier];
+		x = n / numH;
+		y = n % numH;
+		int numCandidates = 0;
+		if (y < numH-1 && visitedFlags->get(x, y+1) && !isGhostTown(x, y+1)) candidates[numCandidates++] = MD_UP;
+		if (x > 0 && visitedFlags->get(x-1, y) && !isGhostTown(x-1, y)) candidates[numCandidates++] = MD_LEFT;
+		if (y > 0 && visitedFlags->get(x, y-1) && !isGhostTown(x, y-1)) candidates[numCandidates++] = MD_DOWN;
+		if (x < numW-1 && visitedFlags->get(x+1, y) && !isGhostTown(x+1, y)) candidates[numCandidates++] = MD_RIGHT;
+		openWall(x, y, (MazeDirection)candidates[die->rollInt(numCandidates)]);
+	}
+	delete[] frontierList;
+	delete[] queued;
+}
+
 void vMaze::refreshAccessibility(int x, int y) {
 	if (x == -1 && y == -1) {
 		// Start at the beginning (center), then move down one to entrance
@@ -537,61 +700,61 @@ void vMaze::refreshAccessibility(int x, int y) {
 		y--;
 		resetAccessibility(); // Sets all squares except ghost town to inaccessible
 		resetVisited();
-		getSquare(x, y)->accessible = true;
+		accessibleFlags->set(x, y);
 	}
-	mazeSquare * current = getSquare(x, y);
 
-	// Check up; if not blocked, ensure accessibility or set and recurse
-	if (y < numH - 1 && !current->wallUp && !getSquare(x, y+1)->accessible) {
-		getSquare(x, y+1)->accessible = true;
-		refreshAccessibility(x, y+1);
-	}
+	// Flood outwards from x,y, a row of words at a time, through squares not already accessible
+	reachFlags->fill(false);
+	reachFlags->set(x, y);
+	flood->fill(vertWalls, horizWalls, reachFlags, accessibleFlags);
+	accessibleFlags->merge(reachFlags);
+}
 
-	// Check down; if not blocked, ensure accessibility or set and recurse
-	if (y > 0 && !current->wallDown && !getSquare(x, y-1)->accessible) {
-		getSquare(x, y-1)->accessible = true;
-		refreshAccessibility(x, y-1);
+void vMaze::releaseActors() {
+	for (size_t i = 0; i < pacmen.size(); i++) {
+		delete pacmen[i];
 	}
-
-	// Check left; if not blocked, ensure accessibility or set and recurse
-	if (x > 0 && !current->wallLeft && !getSquare(x-1, y)->accessible) {
-		getSquare(x-1, y)->accessible = true;
-		refreshAccessibility(x-1, y);
+	for (size_t i = 0; i < ghosts.size(); i++) {
+		delete ghosts[i];
 	}
+	pacmen.clear();
+	ghosts.clear();
+	if (actors != NULL) actors->clear();
+	pacman = blinky = pinky = inky = clyde = NULL;
+}
 
-	// Check right; if not blocked, ensure accessibility or set and recurse
-	if (x < numW - 1 && !current->wallRight && !getSquare(x+1, y)->accessible) {
-		getSquare(x+1, y)->accessible = true;
-		refreshAccessibility(x+1, y);
+void vMaze::refreshField(int * field, std::vector<int> & sources, int first, int last) {
+	// One multi-source plot from every living actor's square; actors cross into new squares only every few dozen
+	// ticks, so most of the time the sources are unchanged and the old plot stands
+	fieldSources.clear();
+	for (int i = first; i < last; i++) {
+		if ((actors->flags[i] & AF_ALIVE) && actors->cellX[i] >= 0 && actors->cellX[i] < numW && actors->cellY[i] >= 0 && actors->cellY[i] < numH) {
+			fieldSources.push_back(actors->cellX[i] * numH + actors->cellY[i]);
+		}
 	}
-	current = NULL;
+	if (fieldSources == sources) return;
+	sources = fieldSources;
+	flood->plotMany(vertWalls, horizWalls, layoutStamp, field, fieldSources.empty() ? NULL : &fieldSources[0], (int)fieldSources.size());
 }
 
 void vMaze::resetAccessibility() {
-	mazeSquare * current = NULL;
+	// Only ghost town is accessible to begin with
 	int centerX = numW / 2;
 	int centerY = numH / 2;
-	for (int i = 0; i < numW; i++) {
-		for (int j = 0; j < numH; j++) {
-			current = getSquare(i, j);
-			if ((i == centerX && j == centerY) || (i == centerX && j == centerY-1) || (i == centerX-1 && j == centerY) || (i == centerX+1 && j == centerY)) {
-				current->accessible = true;
-			} else {
-				current->accessible = false;
-			}
-		}
-	}
-	current = NULL;
+	accessibleFlags->fill(false);
+	accessibleFlags->set(centerX, centerY);
+	accessibleFlags->set(centerX, centerY-1);
+	accessibleFlags->set(centerX-1, centerY);
+	accessibleFlags->set(centerX+1, centerY);
 }
 
 void vMaze::resetSquares(bool empty) {
-	mazeSquare * current = NULL;
-	for (int i = 0; i < numW; i++) {
-		for (int j = 0; j < numH; j++) {
-			current = getSquare(i, j);
-			current->reset(empty);
-		}
-	}
+	// Walls are cleared (or filled) a row of words at a time
+	vertWalls->fill(!empty);
+	horizWalls->fill(!empty);
+	layoutStamp++;
+	visitedFlags->fill(false);
+	accessibleFlags->fill(false);
 
 	if (empty) {
 		// Borders should still be solid
@@ -600,53 +763,33 @@ void vMaze::resetSquares(bool empty) {
 		setHorizWall(0);
 		setHorizWall(numH);
 	}
-	current = NULL;
 }
 
 void vMaze::resetVisited() {
-	mazeSquare * current = NULL;
-	for (int i = 0; i < numW; i++) {
-		for (int j = 0; j < numH; j++) {
-			current = getSquare(i, j);
-			current->visited = false;
-		}
-	}
-	current = NULL;
+	visitedFlags->fill(false);
 }
 
-void vMaze::resize(int w, int h, aGraphics * context) {
-	if (squares != NULL) {
-		delete[] squares;
-		squares = NULL;
-	}
-	if (numW % 2 != 0) numW++;
-	if (numH % 2 != 0) numH++;
-	numW = w > 0 ? w : 1;
-	numH = h > 0 ? h : 1;
-	squares = new mazeSquare[numW*numH];
+void vMaze::resize(int w, int h) {
+	resizeSquares(w, h);
 
-	// Calculate coordinate offset
-	dx = (int)(context->getWidth() / 2 - (numW * squareDim) / 2);
-	dy = (int)(context->getHeight() / 2 - (numH * squareDim) / 2);
+	// Calculate coordinate offset, centering the maze in the viewport
+	dx = (int)(viewW / 2 - (numW * squareDim) / 2);
+	dy = (int)(viewH / 2 - (numH * squareDim) / 2);
+	layoutStamp++;
 
-	// Initialize items
-	if (items != NULL) {
-		delete[] items;
-		items = NULL;
-	}
-	items = new vItem[numW*numH];
+	// Initialize items; the grid keeps the tally current from here on
+	items->resize(numW, numH);
 	int centerX = (int)(numW / 2);
 	int centerY = (int)(numH / 2);
 	for (int i = 0; i < numW; i++) {
 		for (int j = 0; j < numH; j++) {
 			// Items default to small dots
-			items[i * numH + j].specifyTexture(textures);
 			if ((centerX - i) * (centerX - i) <= 1 && j == centerY) {
 				// Disable ghost town squares
-				items[i * numH + j].disable();
+				items->disable(i, j);
 			} else if ((i == 0 && j == 0) || (i == 0 && j == centerY) || (i == 0 && j == numH-1) || (i == centerX && j == 0) || (i == centerX && j == numH-1) || (i == numW-1 && j == 0) || (i == numW-1 && j == centerY) || (i == numW-1 && j == numH-1)) {
 				// Assign large dots to symmetrical locations
-				items[i * numH + j].setItemType(IT_LARGE_DOT);
+				items->setItemType(i, j, IT_LARGE_DOT);
 			} else {
 				// Randomly assign others based on level (point value)
 				float roll = die->rollFloat(1.0f);
@@ -655,37 +798,65 @@ void vMaze::resize(int w, int h, aGraphics * context) {
 					int randOffset = die->rollInt(6);
 					if (randOffset == 5) { itemNum += 2; }
 					else if (randOffset >= 3) { itemNum += 1; }
-					items[i * numH + j].setItemType((itemType)(itemNum + 2));
+					items->setItemType(i, j, (itemType)(itemNum + 2));
 				}
 			}
 		}
 	}
 	levelPoints = getCurrentPointsTotal();
+
+	// Actors are re-indexed once they've been placed in the new layout
+	pacmanCells->resize(numW, numH, actors->getSize());
+	ghostCells->resize(numW, numH, actors->getSize());
+}
+
+void vMaze::resizeSquares(int w, int h) {
+	// Reallocates the wall and flag grids and the per-square scratch buffers; items are left alone. Smaller mazes than
+	// the generators can handle are grown to the minimum, so ghost town and the carvers' start squares always fit.
+	numW = w > MAZE_MIN_W ? w : MAZE_MIN_W;
+	numH = h > MAZE_MIN_H ? h : MAZE_MIN_H;
+	vertWalls->resize(numW+1, numH);
+	horizWalls->resize(numW, numH+1);
+	layoutStamp++;
+	visitedFlags->resize(numW, numH);
+	accessibleFlags->resize(numW, numH);
+	reachFlags->resize(numW, numH);
+	if (distances != NULL) {
+		delete[] distances;
+		distances = NULL;
+	}
+	distances = new int[numW*numH];
+	if (dangerField != NULL) {
+		delete[] dangerField;
+		dangerField = NULL;
+	}
+	dangerField = new int[numW*numH];
+	if (preyField != NULL) {
+		delete[] preyField;
+		preyField = NULL;
+	}
+	preyField = new int[numW*numH];
+	dangerStale = preyStale = true;
+	dangerSources.assign(1, -1);
+	preySources.assign(1, -1);
+	searchQueue.assign(numW*numH, 0);
+	searchDist.assign(numW*numH, 0);
+	searchStamps.assign(numW*numH, 0);
+	searchStamp = 0;
+	routes->clear();
 }
 
 void vMaze::setVertWall(int v) {
-	mazeSquare * current = NULL;
-	if (v == 0) {
-		for (int i = 0; i < numH; i++) {
-			current = getSquare(v, i);
-			current->wallLeft = true;
-		}
-	} else if (v == numW) {
-		for (int i = 0; i < numH; i++) {
-			current = getSquare(v-1, i);
-			current->wallRight = true;
-		}
-	} else if (v < 0 || v > numW) {
-		return;
-	} else {
-		for (int i = 0; i < numH; i++) {
-			current = getSquare(v-1, i);
-			current->wallRight = true;
-			current = getSquare(v, i);
-			current->wallLeft = true;
+	// Sets the whole vertical wall line v, from bottom to top; the stamp only moves if a wall was missing
+	if (v < 0 || v > numW) return;
+	bool changed = false;
+	for (int i = 0; i < numH; i++) {
+		if (!vertWalls->get(v, i)) {
+			vertWalls->set(v, i);
+			changed = true;
 		}
 	}
-	current = NULL;
+	if (changed) layoutStamp++;
 }
 
 void vMaze::setVertWall(int x, int y, bool s) {
@@ -694,40 +865,23 @@ void vMaze::setVertWall(int x, int y, bool s) {
 	// y |   |   |
 	//    -------
 	//       x
-	mazeSquare * left = getSquare(x-1, y);
-	if (left != NULL) {
-		left->wallRight = s;
-	}
-	mazeSquare * right = getSquare(x, y);
-	if (right != NULL) {
-		right->wallLeft = s;
-	}
-	left = NULL; right = NULL;
+	if (x < 0 || x > numW || y < 0 || y >= numH || vertWalls->get(x, y) == s) return;
+	vertWalls->set(x, y, s);
+	layoutStamp++;
 }
 
 void vMaze::setHorizWall(int h) {
-	mazeSquare * current = NULL;
-	if (h == 0) {
-		for (int i = 0; i < numW; i++) {
-			current = getSquare(i, h);
-			current->wallDown = true;
-		}
-	} else if (h == numH) {
-		for (int i = 0; i < numW; i++) {
-			current = getSquare(i, h-1);
-			current->wallUp = true;
-		}
-	} else if (h < 0 || h > numH) {
-		return;
-	} else {
-		for (int i = 0; i < numW; i++) {
-			current = getSquare(i, h-1);
-			current->wallUp = true;
-			current = getSquare(i, h);
-			current->wallDown = true;
+	// Sets the whole horizontal wall line h, a row of words at a time
+	if (h < 0 || h > numH) return;
+	uint64_t * row = horizWalls->getRow(h);
+	for (int w = 0; w < horizWalls->getRowWords(); w++) {
+		uint64_t mask = horizWalls->getRowMask(w);
+		if ((row[w] & mask) != mask) {
+			horizWalls->fillRow(h, true);
+			layoutStamp++;
+			return;
 		}
 	}
-	current = NULL;
 }
 
 void vMaze::setHorizWall(int x, int y, bool s) {
@@ -738,22 +892,17 @@ void vMaze::setHorizWall(int x, int y, bool s) {
 	//   |   |
 	//    ---
 	//     x
-	if (numW > 100) {
-		bool a = true;
-	}
-	mazeSquare * down = getSquare(x, y-1);
-	if (down != NULL) {
-		down->wallUp = s;
-	}
-	mazeSquare * up = getSquare(x, y);
-	if (up != NULL) {
-		up->wallDown = s;
-	}
-	down = NULL; up = NULL;
+	if (x < 0 || x >= numW || y < 0 || y > numH || horizWalls->get(x, y) == s) return;
+	horizWalls->set(x, y, s);
+	layoutStamp++;
 }
 
 // --- Accessors --- //
 
+MazeAlg vMaze::getAlgorithm() {
+	return algorithm;
+}
+
 bool vMaze::getIsPaused() {
 	return isPaused;
 }
@@ -765,21 +914,25 @@ bool vMaze::getSoundFlag(int n) {
 
 int vMaze::getCurrentPointsTotal() {
 	// Returns the total point value of all unconsumed items in this level
-	int toReturn = 0;
-	for (int i = 0; i < numW; i++) {
-		for (int j = 0; j < numH; j++) {
-			if (!items[i * numH + j].getIsConsumed()) {
-				toReturn += items[i * numH + j].getPointValue();
-			}
-		}
+	return items->getTally().remainingPoints;
+}
+
+int * vMaze::getDangerField() {
+	if (dangerStale) {
+		refreshField(dangerField, dangerSources, (int)pacmen.size(), actors->getSize());
+		dangerStale = false;
 	}
-	return toReturn;
+	return dangerField;
 }
 
 int vMaze::getLevel() {
 	return level;
 }
 
+uint64_t vMaze::getLevelSeed() {
+	return levelSeed;
+}
+
 int vMaze::getNumH() {
 	return numH;
 }
@@ -788,25 +941,84 @@ int vMaze::getNumW() {
 	return numW;
 }
 
+itemTally vMaze::getItemTally() {
+	return items->getTally();
+}
+
+float vMaze::getItemWeight(itemType t) {
+	return itemWeights[(int)t];
+}
+
+float vMaze::getSquareDim() {
+	return squareDim;
+}
+
 int vMaze::getTotalPoints() {
 	return totalPoints;
 }
 
-aTexture * vMaze::getTextures() {
-	return textures;
+double vMaze::getTime() {
+	return simTime;
 }
 
-mazeSquare * vMaze::getSquare(int x, int y) {
-	mazeSquare * toReturn = NULL;
-	if (squares != NULL && x < numW && y < numH) {
-		toReturn = &(squares[x * numH + y]);
-		if (x == 4 && !toReturn->wallRight) {
-			bool breakMe = true;
-		}
+int vMaze::getViewH() {
+	return viewH;
+}
+
+int vMaze::getViewW() {
+	return viewW;
+}
+
+vRouteTable * vMaze::getRouteTable() {
+	return routes;
+}
+
+mazeSquare vMaze::getSquare(int x, int y) {
+	// Compatibility view of a single square; walls are shared with (and identical to) the neighboring squares
+	mazeSquare toReturn;
+	if (x >= 0 && x < numW && y >= 0 && y < numH) {
+		toReturn.wallUp = horizWalls->get(x, y+1);
+		toReturn.wallDown = horizWalls->get(x, y);
+		toReturn.wallLeft = vertWalls->get(x, y);
+		toReturn.wallRight = vertWalls->get(x+1, y);
+		toReturn.visited = visitedFlags->get(x, y);
+		toReturn.accessible = accessibleFlags->get(x, y);
 	}
 	return toReturn;
 }
 
+bool vMaze::getWall(int x, int y, MazeDirection direction) {
+	// Squares outside the maze are solid
+	if (x < 0 || x >= numW || y < 0 || y >= numH) return true;
+	switch (direction) {
+		case MD_UP:
+			return horizWalls->get(x, y+1);
+		case MD_LEFT:
+			return vertWalls->get(x, y);
+		case MD_DOWN:
+			return horizWalls->get(x, y);
+		case MD_RIGHT:
+			return vertWalls->get(x+1, y);
+		default:
+			return false;
+	}
+}
+
+size_t vMaze::getLayoutBytes() {
+	// Memory used by walls and per-square flags
+	return vertWalls->getBytes() + horizWalls->getBytes() + visitedFlags->getBytes() + accessibleFlags->getBytes();
+}
+
+unsigned int vMaze::getLayoutStamp() {
+	return layoutStamp;
+}
+
+vActor * vMaze::getActor(int slot) {
+	// Pacmen were added to the table first, then ghosts
+	int numPacmen = (int)pacmen.size();
+	return slot < numPacmen ? pacmen[slot] : ghosts[slot - numPacmen];
+}
+
 vActor * vMaze::getActorByType(spriteType actorType) {
 	// Returns the address of the actor with the given type
 	vActor * toReturn = NULL;
@@ -831,28 +1043,163 @@ vActor * vMaze::getActorByType(spriteType actorType) {
 	return toReturn;
 }
 
-vActor * vMaze::getSelection() {
-	// Returns the address of the first actor that is selected
-	for (int i = 0; i < 5; i++) {
-		if (getActorByType((spriteType)i)->getIsSelected()) {
-			return getActorByType((spriteType)i);
+vActorTable * vMaze::getActorTable() {
+	return actors;
+}
+
+vActor * vMaze::getGhost(int i) {
+	return ghosts[i];
+}
+
+vActor * vMaze::getPacman(int i) {
+	return pacmen[i];
+}
+
+int vMaze::getNumActors() {
+	return actors->getSize();
+}
+
+int vMaze::getNumAliveGhosts() {
+	int toReturn = 0;
+	for (size_t i = 0; i < ghosts.size(); i++) {
+		if (ghosts[i]->getIsAlive()) toReturn++;
+	}
+	return toReturn;
+}
+
+int vMaze::getNumAlivePacmen() {
+	int toReturn = 0;
+	for (size_t i = 0; i < pacmen.size(); i++) {
+		if (pacmen[i]->getIsAlive()) toReturn++;
+	}
+	return toReturn;
+}
+
+int vMaze::getNumGhosts() {
+	return (int)ghosts.size();
+}
+
+int vMaze::getNumPacmen() {
+	return (int)pacmen.size();
+}
+
+int * vMaze::getPreyField() {
+	if (preyStale) {
+		refreshField(preyField, preySources, 0, (int)pacmen.size());
+		preyStale = false;
+	}
+	return preyField;
+}
+
+vActor * vMaze::findSelection() const {
+	// Returns the address of the first actor that is selected, or NULL; selects nothing itself
+	int numActors = actors->getSize();
+	int numPacmen = (int)pacmen.size();
+	for (int i = 0; i < numActors; i++) {
+		if (actors->flags[i] & AF_SELECTED) {
+			return i < numPacmen ? pacmen[i] : ghosts[i - numPacmen];
 		}
 	}
+	return NULL;
+}
+
+vActor * vMaze::getSelection() {
+	// Returns the address of the first actor that is selected, selecting pacman if there is none
+	vActor * selection = findSelection();
+	if (selection != NULL) return selection;
 	pacman->select();
 	return pacman;
 }
 
-vItem * vMaze::getItem(int x, int y) {
-	if (items != NULL && x < numW && y < numH) {
-		return &(items[x * numH + y]);
-	}
-	return NULL;
+vItemGrid * vMaze::getItems() {
+	return items;
+}
+
+void vMaze::setAlgorithm(MazeAlg a) {
+	// Takes effect at the next newLevel()
+	algorithm = a;
+}
+
+void vMaze::setItemWeight(itemType t, float w) {
+	itemWeights[(int)t] = w > 0.0f ? w : 0.0f;
+}
+
+void vMaze::setLevel(int l) {
+	level = l > 0 ? l : 0;
+}
+
+void vMaze::setLevelSeed(uint64_t s) {
+	// Used by the next newLevel() in place of a drawn seed, to replay a level
+	levelSeed = s;
+	hasLevelSeed = true;
 }
+
+void vMaze::setSeed(uint64_t s) {
+	// Restarts the maze's sequence; level seeds are drawn from it from here on
+	die->setSeed(s);
+}
+
+void vMaze::setPopulation(int numPacmen, int numGhosts) {
+	// Timed effects refer to the old actors
+	if (numPacmen < 1) numPacmen = 1;
+	if (numGhosts < 4) numGhosts = 4;
+	timers->clear();
+	vulnerabilityTimer = -1;
+	releaseActors();
+
+	// Pacmen first, so they take the first slots of the table
+	for (int i = 0; i < numPacmen; i++) {
+		vActor * p = new vActor(actors);
+		p->setType(V_PACMAN);
+		p->setMode(AI_GREEDY);
+		pacmen.push_back(p);
+	}
+
+	// Ghost colors (and starting headings) cycle through blinky, pinky, inky and clyde
+	static const spriteState headings[4] = { SS_UP2, SS_LEFT2, SS_DOWN2, SS_RIGHT2 };
+	for (int i = 0; i < numGhosts; i++) {
+		vActor * g = new vActor(actors);
+		g->setType((spriteType)((int)V_RED_G + i % 4));
+		g->setState(headings[i % 4]);
+		ghosts.push_back(g);
+		placeGhost(i);
+	}
+	pacman = pacmen[0];
+	blinky = ghosts[0];
+	pinky = ghosts[1];
+	inky = ghosts[2];
+	clyde = ghosts[3];
+
+	// Stagger animations; abilities start out cooling down, as if each actor had just used one
+	for (int i = 0; i < actors->getSize(); i++) {
+		actors->timeSeed[i] = die->rollFloat(animationPeriod);
+		actors->abilityTriggered[i] = simTime;
+	}
+	pacmanCells->resize(numW, numH, actors->getSize());
+	ghostCells->resize(numW, numH, actors->getSize());
+	locateActors();
+}
+
 void vMaze::setSoundFlag(int n, bool s) {
 	if (n < 0 || n >= numEffects) n = 0;
 	soundFlags[n] = s;
 }
 
+void vMaze::setTime(double t) {
+	simTime = t;
+	timers->reset(t);
+	vulnerabilityTimer = -1;
+	for (int i = 0; i < actors->getSize(); i++) {
+		actors->abilityTimer[i] = -1;
+	}
+}
+
+void vMaze::setViewport(int w, int h) {
+	// Takes effect at the next newLevel()
+	viewW = w;
+	viewH = h;
+}
+
 void vMaze::pause() {
 	isPaused = true;
 }
@@ -864,16 +1211,91 @@ void vMaze::unpause() {
 // --- Methods --- //
 
 bool vMaze::checkAccessibility() {
-	for (int i = 0; i < numW; i++) {
-		for (int j = 0; j < numH; j++) {
-			if (!getSquare(i, j)->accessible) {
-				return false;
+	// Checked a word at a time
+	return accessibleFlags->all();
+}
+
+bool vMaze::findItem(int x, int y, int * itemX, int * itemY) {
+	// Breadth-first from x,y through open walls. Items score their weight over (1 + maze distance); the walk stops as
+	// soon as no square further out could beat the best score so far, so with equal weights it ends at the first
+	// (nearest) item, having only visited the squares closer than it
+	if (x < 0 || x >= numW || y < 0 || y >= numH) return false;
+	itemTally tally = items->getTally();
+	float maxWeight = 0.0f;
+	for (int i = 0; i < numItemTypes; i++) {
+		if (itemWeights[i] > maxWeight && tally.getRemaining((itemType)i) > 0) maxWeight = itemWeights[i];
+	}
+	if (maxWeight <= 0.0f) return false;
+	searchStamp++;
+	if (searchStamp == 0) {
+		// Wrapped; old marks could pass for new ones
+		for (size_t i = 0; i < searchStamps.size(); i++) searchStamps[i] = -1;
+		searchStamp = 1;
+	}
+	int head = 0;
+	int tail = 0;
+	int best = -1;
+	float bestScore = 0.0f;
+	searchQueue[tail++] = x * numH + y;
+	searchStamps[x * numH + y] = searchStamp;
+	searchDist[x * numH + y] = 0;
+	while (head < tail) {
+		int c = searchQueue[head++];
+		int d = searchDist[c];
+		if (best != -1 && maxWeight / (1.0f + d) <= bestScore) break;
+		int cx = c / numH;
+		int cy = c % numH;
+		if (!items->getIsConsumed(cx, cy)) {
+			float score = itemWeights[(int)items->getItemType(cx, cy)] / (1.0f + d);
+			if (score > bestScore) {
+				best = c;
+				bestScore = score;
+			}
+		}
+		int neighbors[4] = { cy < numH-1 && !getWall(cx, cy, MD_UP) ? c + 1 : -1, cx > 0 && !getWall(cx, cy, MD_LEFT) ? c - numH : -1,
+			cy > 0 && !getWall(cx, cy, MD_DOWN) ? c - 1 : -1, cx < numW-1 && !getWall(cx, cy, MD_RIGHT) ? c + numH : -1 };
+		for (int i = 0; i < 4; i++) {
+			int n = neighbors[i];
+			if (n != -1 && searchStamps[n] != searchStamp) {
+				searchStamps[n] = searchStamp;
+				searchDist[n] = d + 1;
+				searchQueue[tail++] = n;
 			}
 		}
 	}
+	if (best == -1) return false;
+	*itemX = best / numH;
+	*itemY = best % numH;
 	return true;
 }
 
+vActor * vMaze::findNearest(int x, int y, bool findGhost) {
+	int slot = -1;
+	if ((findGhost ? ghostCells : pacmanCells)->nearest(this, x, y, 1, &slot) == 0) return NULL;
+	return getActor(slot);
+}
+
+int vMaze::findNearest(int x, int y, bool findGhost, int k, vActor ** found) {
+	// Walks outwards from x,y through open walls; equally near actors come in no particular order
+	if (k <= 0) return 0;
+	std::vector<int> slots(k);
+	int numFound = (findGhost ? ghostCells : pacmanCells)->nearest(this, x, y, k, &slots[0]);
+	for (int i = 0; i < numFound; i++) {
+		found[i] = getActor(slots[i]);
+	}
+	return numFound;
+}
+
+bool vMaze::stressTest(int w, int h, MazeAlg a) {
+	// Generates a (potentially huge) maze of the given size without items or actors, then re-floods accessibility
+	// from scratch and checks that every square was reached. Leaves the maze unplayable until the next newLevel().
+	if (w < MAZE_MIN_W || h < MAZE_MIN_H) return false;
+	resizeSquares(w, h);
+	generate(a);
+	refreshAccessibility();
+	return checkAccessibility();
+}
+
 bool vMaze::executeAbility(vActor * subject) {
 	// Executes special ability, sets ability timer, and returns success
 	bool success = true;
@@ -881,10 +1303,8 @@ bool vMaze::executeAbility(vActor * subject) {
 
 	// Controls level scaling for ability parameters, from 0.0f to 1.0f
 	int cx, cy = 0;
-	Dice die = Dice();
-	time_t currentTime;
-	time(&currentTime);
-	if (difftime(currentTime, subject->getAbilityTriggered()) < subject->getLevel()) {
+	double currentTime = simTime;
+	if (currentTime - subject->getAbilityTriggered() < subject->getLevel()) {
 		// Ability still cooling down
 		return false;
 	}
@@ -893,33 +1313,35 @@ bool vMaze::executeAbility(vActor * subject) {
 		case V_RED_G:
 			// Sprint! (increase speed)
 			// Check ability duration (level) + cooldown (level)
-			if (difftime(currentTime, subject->getAbilityTriggered()) < 2 * subject->getLevel()) {
+			if (currentTime - subject->getAbilityTriggered() < 2 * subject->getLevel()) {
 				return false;
 			}
 			// Adjust velocity
-			blinky->setVelocity(baseVelocity * 0.8f * (2.0f - pow(0.5f, (float)subject->getLevel())));
-			if (blinky->getVelX() != 0.0f) {
-				blinky->setVelX(blinky->getVelX() > 0 ? blinky->getVelocity() : -blinky->getVelocity());
+			subject->setVelocity(baseVelocity * 0.8f * (2.0f - pow(0.5f, (float)subject->getLevel())));
+			timers->cancel(actors->abilityTimer[subject->getSlot()]);
+			actors->abilityTimer[subject->getSlot()] = timers->schedule(currentTime + subject->getLevel(), endSprint, this, subject);
+			if (subject->getVelX() != 0.0f) {
+				subject->setVelX(subject->getVelX() > 0 ? subject->getVelocity() : -subject->getVelocity());
 			}
-			if (blinky->getVelY() != 0.0f) {
-				blinky->setVelY(blinky->getVelY() > 0 ? blinky->getVelocity() : -blinky->getVelocity());
+			if (subject->getVelY() != 0.0f) {
+				subject->setVelY(subject->getVelY() > 0 ? subject->getVelocity() : -subject->getVelocity());
 			}
 			break;
 		case V_PINK_G:
 			// Jump! (skip walls)
-			cx = screenX2mazeX((int)(subject->getX().value));
-			cy = screenY2mazeY((int)(subject->getY().value));
+			cx = screenX2mazeX((int)(subject->getX()));
+			cy = screenY2mazeY((int)(subject->getY()));
 			if (subject->getState() <= (int)SS_UP3) {
-				cy += pinky->getLevel();
+				cy += subject->getLevel();
 				if (cy >= numH) cy = numH-1;
 			} else if (subject->getState() <= (int)SS_DOWN3) {
-				cy -= pinky->getLevel();
+				cy -= subject->getLevel();
 				if (cy < 0) cy = 0;
 			} else if (subject->getState() <= (int)SS_LEFT3) {
-				cx -= pinky->getLevel();
+				cx -= subject->getLevel();
 				if (cx < 0) cx = 0;
 			} else if (subject->getState() <= (int)SS_RIGHT3) {
-				cx += pinky->getLevel();
+				cx += subject->getLevel();
 				if (cx >= numW) cx = numW-1;
 			}
 			moveToMazeXY(subject, cx, cy);
@@ -927,20 +1349,22 @@ bool vMaze::executeAbility(vActor * subject) {
 		case V_BLUE_G:
 			// Immunity (change scared state)
 			// Check ability duration (level) + cooldown (level)
-			if (difftime(currentTime, subject->getAbilityTriggered()) < 2 * subject->getLevel()) {
+			if (currentTime - subject->getAbilityTriggered() < 2 * subject->getLevel()) {
 				return false;
 			}
 			// Break vulnerability
-			inky->setScared(false);
+			subject->setScared(false);
+			timers->cancel(actors->abilityTimer[subject->getSlot()]);
+			actors->abilityTimer[subject->getSlot()] = timers->schedule(currentTime + subject->getLevel(), endImmunity, this, subject);
 			break;
 		case V_ORANGE_G:
 			// Scatter (teleport)
-			cx = screenX2mazeX((int)(subject->getX().value));
-			cy = screenY2mazeY((int)(subject->getY().value));
+			cx = screenX2mazeX((int)(subject->getX()));
+			cy = screenY2mazeY((int)(subject->getY()));
 			int newX, newY;
 			do {
-				newX = die.rollIntRange(cx - 2 * clyde->getLevel(), cx + 2 * clyde->getLevel());
-				newY = die.rollIntRange(cy - 2 * clyde->getLevel(), cy + 2 * clyde->getLevel());
+				newX = die->rollIntRange(cx - 2 * subject->getLevel(), cx + 2 * subject->getLevel());
+				newY = die->rollIntRange(cy - 2 * subject->getLevel(), cy + 2 * subject->getLevel());
 				if (newX < 0) newX = 0;
 				if (newX >= numW) newX = numW-1;
 				if (newY < 0) newY = 0;
@@ -952,50 +1376,48 @@ bool vMaze::executeAbility(vActor * subject) {
 			success = false;
 			break;
 	}
-	if (success) subject->setAbilityTriggered(currentTime);
+	if (success) {
+		subject->setAbilityTriggered(currentTime);
+		locateActors();
+	}
 	return success;
 }
 
-void vMaze::aStarPlot(int * values, int x, int y) {
-	// Should only be looking from registered squares
-	int curr = values[x * numH + y];
-	if (curr == -1) {
-		return;
-	}
-
-	// Recurse up
-	if (y < numH-1 && (values[x * numH + y+1] > curr + 1 || values[x * numH + y+1] == -1) && !getSquare(x, y)->wallUp) {
-		values[x * numH + y+1] = curr + 1;
-		aStarPlot(values, x, y+1);
-	}
+void vMaze::aStarPlot(int * values, int x, int y, vFlood * scratch) {
+	// Breadth-first plot outwards from x,y, one whole distance layer at a time
+	// A caller-supplied flood object lets several plots run at once
+	if (scratch == NULL) scratch = flood;
+	scratch->plot(vertWalls, horizWalls, layoutStamp, values, x, y);
+}
 
-	// Recurse left
-	if (x > 0 && (values[(x-1) * numH + y] > curr + 1 || values[(x-1) * numH + y] == -1) && !getSquare(x, y)->wallLeft) {
-		values[(x-1) * numH + y] = curr + 1;
-		aStarPlot(values, x-1, y);
-	}
+MazeDirection vMaze::stepTowards(int * values, int cx, int cy) {
+	// Picks the open neighbor with the shortest plotted distance; ties favor up, left, down, then right
+	int unreachable = numW * numH;
+	if (cx < 0 || cx >= numW || cy < 0 || cy >= numH) return MD_NONE;
+	mazeSquare currSquare = getSquare(cx, cy);
 
-	// Recurse down
-	if (y > 0 && (values[x * numH + y-1] > curr + 1 || values[x * numH + y-1] == -1) && !getSquare(x, y)->wallDown) {
-		values[x * numH + y-1] = curr + 1;
-		aStarPlot(values, x, y-1);
-	}
-
-	// Recurse right
-	if (x < numW-1 && (values[(x+1) * numH + y] > curr + 1 || values[(x+1) * numH + y] == -1) && !getSquare(x, y)->wallRight) {
-		values[(x+1) * numH + y] = curr + 1;
-		aStarPlot(values, x+1, y);
-	}
-}
+	// Check path distances to each side
+	int up = cy < numH-1 ? values[cx * numH + cy+1] : unreachable;
+	int left = cx > 0 ? values[(cx-1) * numH + cy] : unreachable;
+	int down = cy > 0 ? values[cx * numH + cy-1] : unreachable;
+	int right = cx < numW-1 ? values[(cx+1) * numH + cy] : unreachable;
 
-void vMaze::drawWallSegment(int k, int x, int y, aGraphics * context) {
-	// Renders segment at maze coordinates x, y using texture key k
-	if (wallSegment == NULL) { return; }
-	int screenX = (int)((x) * squareDim) + dx - (int)(squareDim / 2);
-	int screenY = (int)((y) * squareDim) + dy - (int)(squareDim / 2);
-	wallSegment->moveToPix(screenX, screenY);
-	wallSegment->setState((spriteState)k);
-	wallSegment->render(context);
+	// Enforce bounds
+	if (up < 0 || up > unreachable || currSquare.wallUp) up = unreachable;
+	if (left < 0 || left > unreachable || currSquare.wallLeft) left = unreachable;
+	if (down < 0 || down > unreachable || currSquare.wallDown) down = unreachable;
+	if (right < 0 || right > unreachable || currSquare.wallRight) right = unreachable;
+
+	if (up <= left && up <= down && up <= right && !currSquare.wallUp) {
+		return MD_UP;
+	} else if (left <= down && left <= right && !currSquare.wallLeft) {
+		return MD_LEFT;
+	} else if (down <= right && !currSquare.wallDown) {
+		return MD_DOWN;
+	} else if (!currSquare.wallRight) {
+		return MD_RIGHT;
+	}
+	return MD_NONE;
 }
 
 void vMaze::moveToMazeXY(vActor * actor, int x, int y) {
@@ -1004,10 +1426,21 @@ void vMaze::moveToMazeXY(vActor * actor, int x, int y) {
 	actor->moveToPix(cellX, cellY);
 }
 
-void vMaze::newLevel(aGraphics * context, bool reset) {
+void vMaze::levelUpType(spriteType t) {
+	for (size_t i = 0; i < ghosts.size(); i++) {
+		if (ghosts[i]->getType() == t) ghosts[i]->levelUp();
+	}
+}
+
+void vMaze::newLevel(bool reset) {
 	// New level: resize, re-generate...
 	level = reset ? 1 : level + 1;
-	pacman->setLife(true);
+
+	// Everything random in the level (layout, items, pacman's start, AI and abilities) follows from the level seed,
+	// drawn from the previous level's sequence unless one was given
+	if (!hasLevelSeed) levelSeed = die->next();
+	hasLevelSeed = false;
+	die->setSeed(levelSeed);
 
 	// Update point totals
 	if (level == 1) {
@@ -1019,184 +1452,95 @@ void vMaze::newLevel(aGraphics * context, bool reset) {
 	// Maze size starts at 5x7 and asymptotically approaches 13x17
 	int w = (int)((minW - maxW) / ((maxW - minW) * levelScaleSpeed * (level-1) + 1) + maxW);
 	int h = (int)((minH - maxH) / ((maxH - minH) * levelScaleSpeed * (level-1) + 1) + maxH);
-	resize(w, h, context);
-
-	// Start pacman in random location along edge
-	Dice die = Dice();
-	int location = die.rollInt(2 * numW + 2 * numH);
-	int pacX, pacY;
-	if (location < numW) {
-		pacX = location;
-		pacY = numH-1;
-	} else if (location < numW + numH) {
-		pacX = 0;
-		pacY = location - numW;
-	} else if (location < 2 * numW + numH) {
-		pacX = location - numH - numW;
-		pacY = 0;
-	} else {
-		pacX = numW-1;
-		pacY = location - 2 * numW - numH;
-	}
-	moveToMazeXY(pacman, pacX, pacY);
-	items[pacX * numH + pacY].consume();
-
-	// Available ghosts will depend upon level; reset to locations
-	blinky->setLife(level > 0);
-	pinky->setLife(level > 2);
-	inky->setLife(level > 4);
-	clyde->setLife(level > 6);
-
-	// Set ghost locations
-	moveToMazeXY(blinky, numW / 2, numH / 2 - 1);
-	moveToMazeXY(pinky, numW / 2 - 1, numH / 2);
-	moveToMazeXY(inky, numW / 2 + 1, numH / 2);
-	moveToMazeXY(clyde, numW / 2, numH / 2);
-
-	// Reset all velocities
-	pacman->setVelX(0.0f); pacman->setVelY(0.0f);
-	blinky->setVelX(0.0f); blinky->setVelY(0.0f);
-	pinky->setVelX(0.0f); pinky->setVelY(0.0f);
-	inky->setVelX(0.0f); inky->setVelY(0.0f);
-	clyde->setVelX(0.0f); clyde->setVelY(0.0f);
-
-	// Blinky will be selected first
-	pacman->deselect();
-	blinky->select();
-	pinky->deselect();
-	inky->deselect();
-	clyde->deselect();
-
-	// Generate maze
-	generate(MA_DIVISION);
-
-	// Reset ghost 'scared'ness
-	blinky->setScared(false);
-	pinky->setScared(false);
-	inky->setScared(false);
-	clyde->setScared(false);
-
-	// Reset ghost levels, if new game
-	if (reset) {
-		blinky->reset();
-		pinky->reset();
-		inky->reset();
-		clyde->reset();
-	}
-}
-
-void vMaze::renderMaze(aGraphics * context) {
-	// Arrange squares by quadrant
-	mazeSquare * qOne;
-	mazeSquare * qTwo;
-	mazeSquare * qThree;
-
-	// 9 possible states: 4 corners, 4 walls, and interior intersections
-	for (int i = 0; i <= numW; i++) {
-		for (int j = 0; j <= numH; j++) {
-			if (i == 0) {
-				if (j == 0) {
-					// Bottom-left corner
-					drawWallSegment(9, i, j, context);
-				} else if (j == numH) {
-					// Top-left corner
-					drawWallSegment(12, i, j, context);
-				} else {
-					// Left wall
-					qOne = getSquare(i, j);
-					if (qOne->wallDown) {
-						drawWallSegment(13, i, j, context);
-					} else {
-						drawWallSegment(5, i, j, context);
-					}
-				}
-			} else if (i == numW) {
-				if (j == 0) {
-					// Bottom-right corner
-					drawWallSegment(3, i, j, context);
-				} else if (j == numH) {
-					// Top-right corner
-					drawWallSegment(6, i, j, context);
-				} else {
-					// Right wall
-					qTwo = getSquare(i-1, j);
-					if (qTwo->wallDown) {
-						drawWallSegment(7, i, j, context);
-					} else {
-						drawWallSegment(5, i, j, context);
-					}
-				}
-			} else {
-				if (j == 0) {
-					// Bottom wall
-					qOne = getSquare(i, j);
-					if (qOne->wallLeft) {
-						drawWallSegment(11, i, j, context);
-					} else {
-						drawWallSegment(10, i, j, context);
-					}
-				} else if (j == numH) {
-					// Top wall
-					qThree = getSquare(i-1, j-1);
-					if (qThree->wallRight) {
-						drawWallSegment(14, i, j, context);
-					} else {
-						drawWallSegment(10, i, j, context);
-					}
-				} else {
-					// Interior intersection
-					qOne = getSquare(i, j);
-					qThree = getSquare(i-1, j-1);
-					int key = 1 * (int)qOne->wallLeft + 2 * (int)qThree->wallUp + 4 * (int)qThree->wallRight + 8 * (int)qOne->wallDown;
-					drawWallSegment(key, i, j, context);
-				}
-			}
+	resize(w, h);
+
+	// Start each pacman in random location along edge
+	for (size_t i = 0; i < pacmen.size(); i++) {
+		int location = die->rollInt(2 * numW + 2 * numH);
+		int pacX, pacY;
+		if (location < numW) {
+			pacX = location;
+			pacY = numH-1;
+		} else if (location < numW + numH) {
+			pacX = 0;
+			pacY = location - numW;
+		} else if (location < 2 * numW + numH) {
+			pacX = location - numH - numW;
+			pacY = 0;
+		} else {
+			pacX = numW-1;
+			pacY = location - 2 * numW - numH;
 		}
+		pacmen[i]->setLife(true);
+		moveToMazeXY(pacmen[i], pacX, pacY);
+		items->consume(pacX, pacY);
 	}
 
-	// Render items on top; should be 1 in each square
-	for (int i = 0; i < numW; i++) {
-		for (int j = 0; j < numH; j++) {
-			if (!items[i * numH + j].getIsConsumed()) {
-				items[i * numH + j].moveToPix((int)((i) * squareDim) + dx + 10, (int)((j) * squareDim) + dy + 10);
-				items[i * numH + j].render(context);
-			}
-		}
+	// Available ghosts will depend upon level (blinky, pinky, inky, then clyde, in every group of four);
+	// reset to locations
+	for (size_t i = 0; i < ghosts.size(); i++) {
+		ghosts[i]->setLife(level > 2 * (int)(i % 4));
+		placeGhost((int)i);
 	}
 
-	// Render actors (pacman, ghosts)
-	blinky->render(context);
-	pinky->render(context);
-	inky->render(context);
-	clyde->render(context);
-	pacman->render(context);
+	// Reset all velocities; blinky will be selected first
+	int numActors = actors->getSize();
+	for (int i = 0; i < numActors; i++) {
+		actors->xVel[i] = 0.0f;
+		actors->yVel[i] = 0.0f;
+		actors->flags[i] &= (unsigned char)~AF_SELECTED;
+	}
+	blinky->select();
+
+	// Generate maze; walls are fixed from here on, so precompute AI routes (if the table fits within its cap)
+	generate(algorithm);
+	routes->build(this);
+	locateActors();
+
+	// Timed effects don't carry over between levels
+	timers->clear();
+	vulnerabilityTimer = -1;
+	for (int i = 0; i < numActors; i++) {
+		actors->abilityTimer[i] = -1;
+	}
+	for (size_t i = 0; i < pacmen.size(); i++) {
+		pacmen[i]->setMode(AI_GREEDY);
+	}
+
+	// Reset ghost speed and 'scared'ness, and ghost levels if new game
+	for (size_t i = 0; i < ghosts.size(); i++) {
+		ghosts[i]->setVelocity(0.8f * baseVelocity);
+		ghosts[i]->setScared(false);
+		if (reset) ghosts[i]->reset();
+	}
 }
 
 void vMaze::rotateSelection() {
-	// Rotate selected ghost to next alive
-	int currentSelection = (int)(getSelection()->getType());
-	blinky->deselect();
-	pinky->deselect();
-	inky->deselect();
-	clyde->deselect();
-	int numTries = 0;
-	while (numTries < 4) {
-		currentSelection = currentSelection % 4 + 1;
-		if (getActorByType((spriteType)currentSelection)->getIsAlive()) {
-			getActorByType((spriteType)currentSelection)->select();
+	// Rotate selected ghost to next alive (the same one, if it's the only one)
+	int numGhosts = (int)ghosts.size();
+	vActor * current = getSelection();
+	int currentSelection = current->getSlot() - (int)pacmen.size();
+	if (currentSelection < 0) currentSelection = -1;
+	current->deselect();
+	for (int i = 0; i < numGhosts; i++) {
+		ghosts[i]->deselect();
+	}
+	for (int numTries = 1; numTries <= numGhosts; numTries++) {
+		vActor * next = ghosts[(currentSelection + numTries + numGhosts) % numGhosts];
+		if (next->getIsAlive()) {
+			next->select();
 			return;
 		}
-		numTries++;
 	}
 }
 
 void vMaze::turnActor(vActor * actor, MazeDirection direction) {
 	// Calculate relevant coordinates
-	int mazeX = screenX2mazeX((int)(actor->getX().value));
-	int mazeY = screenY2mazeY((int)(actor->getY().value));
+	int mazeX = screenX2mazeX((int)(actor->getX()));
+	int mazeY = screenY2mazeY((int)(actor->getY()));
 	int cellX = mazeX2screenX(mazeX);
 	int cellY = mazeY2screenY(mazeY);
-	mazeSquare * currentSquare = getSquare(mazeX, mazeY);
+	mazeSquare currentSquare = getSquare(mazeX, mazeY);
 	bool invalidTurn = false;
 
 	// Determine current direction
@@ -1218,9 +1562,9 @@ void vMaze::turnActor(vActor * actor, MazeDirection direction) {
 
 	// Validity of direction determined by relative location through square compared to desired direction
 	if (direction == MD_UP || direction == MD_DOWN) {
-		invalidTurn = (actor->getX().value > cellX + 0.25f * squareDim || actor->getX().value < cellX - 0.25f * squareDim) && direction != MD_RIGHT;
+		invalidTurn = (actor->getX() > cellX + 0.25f * squareDim || actor->getX() < cellX - 0.25f * squareDim) && direction != MD_RIGHT;
 	} else if (direction == MD_LEFT || direction == MD_RIGHT) {
-		invalidTurn = (actor->getY().value > cellY + 0.25f * squareDim || actor->getY().value < cellY - 0.25f * squareDim) && direction != MD_DOWN;
+		invalidTurn = (actor->getY() > cellY + 0.25f * squareDim || actor->getY() < cellY - 0.25f * squareDim) && direction != MD_DOWN;
 	}
 
 	// Turn the given actor in the given direction
@@ -1229,21 +1573,21 @@ void vMaze::turnActor(vActor * actor, MazeDirection direction) {
 		case MD_UP:
 			actor->setState(SS_UP2);
 			actor->setVelX(0.0f);
-			actor->setVelY(invalidTurn || (currentSquare->wallUp && actor->getY().value >= cellY) ? 0.0f : actor->getVelocity());
+			actor->setVelY(invalidTurn || (currentSquare.wallUp && actor->getY() >= cellY) ? 0.0f : actor->getVelocity());
 			break;
 		case MD_LEFT:
 			actor->setState(SS_LEFT2);
-			actor->setVelX(invalidTurn || (currentSquare->wallLeft && actor->getX().value <= cellX) ? 0.0f : -actor->getVelocity());
+			actor->setVelX(invalidTurn || (currentSquare.wallLeft && actor->getX() <= cellX) ? 0.0f : -actor->getVelocity());
 			actor->setVelY(0.0f);
 			break;
 		case MD_DOWN:
 			actor->setState(SS_DOWN2);
 			actor->setVelX(0.0f);
-			actor->setVelY(invalidTurn || (currentSquare->wallDown && actor->getY().value <= cellY) ? 0.0f : -actor->getVelocity());
+			actor->setVelY(invalidTurn || (currentSquare.wallDown && actor->getY() <= cellY) ? 0.0f : -actor->getVelocity());
 			break;
 		case MD_RIGHT:
 			actor->setState(SS_RIGHT2);
-			actor->setVelX(invalidTurn || (currentSquare->wallRight && actor->getX().value >= cellX) ? 0.0f : actor->getVelocity());
+			actor->setVelX(invalidTurn || (currentSquare.wallRight && actor->getX() >= cellX) ? 0.0f : actor->getVelocity());
 			actor->setVelY(0.0f);
 			break;
 		default:
@@ -1263,73 +1607,85 @@ void vMaze::turnActor(vActor * actor, MazeDirection direction) {
 }
 
 void vMaze::update(float dt) {
-	if (isPaused) return;
+	// The clock keeps running while paused (level start, leveling), just as wall time did; pausing only freezes actors
+	simTime += dt;
 
-	// Make sure border walls are set
-	setVertWall(0);
-	setVertWall(numW);
-	setHorizWall(0);
-	setHorizWall(numH);
+	// Start of a tick: actors are drawn blended from here towards where this tick leaves them
+	actors->savePositions();
+	if (isPaused) return;
 
-	// need to update pacman position first, for overlap reference in later updates
-	int px = (int)(pacman->getX().value);
-	int py = (int)(pacman->getY().value);
+	// Squares and occupancy grids are current: every move within the maze (ticks, abilities, new levels) re-locates
+	int numActors = actors->getSize();
 
-	// Update actors
-	vActor* currActor = NULL;
-	for (int i = 0; i < 5; i++) {
-		currActor = getActorByType((spriteType)i);
+	// Update actors; pacmen fill the first slots, so they are in place before any ghost checks against them
+	for (int i = 0; i < numActors; i++) {
+		vActor * currActor = getActor(i);
+		bool isPacman = i < (int)pacmen.size();
 		if (currActor->getIsAlive()) {
-			// Calculate maze coordinate and cell center of current location
-			int mx = screenX2mazeX((int)(currActor->getX().value));
-			int my = screenY2mazeY((int)(currActor->getY().value));
+			// Maze coordinate and cell center of current location
+			int mx = actors->cellX[i];
+			int my = actors->cellY[i];
 			int cx = mazeX2screenX(mx);
 			int cy = mazeY2screenY(my);
 
 			// Check to see if actor is fully entered (more than halfway) through the cell
 			bool fullyEntered = false;
-			if (currActor->getVelY() > 0 && currActor->getY().value >= cy) {
+			if (currActor->getVelY() > 0 && currActor->getY() >= cy) {
 				fullyEntered = true;
-			} else if (currActor->getVelX() < 0 && currActor->getX().value <= cx) {
+			} else if (currActor->getVelX() < 0 && currActor->getX() <= cx) {
 				fullyEntered = true;
-			} else if (currActor->getVelY() < 0 && currActor->getY().value <= cy) {
+			} else if (currActor->getVelY() < 0 && currActor->getY() <= cy) {
 				fullyEntered = true;
-			} else if (currActor->getVelX() > 0 && currActor->getX().value >= cx) {
+			} else if (currActor->getVelX() > 0 && currActor->getX() >= cx) {
 				fullyEntered = true;
 			}
 
 			// Check pacman, ghost coordinates for intersection (will someone be eaten?)
-			if (currActor == pacman) {
-				px = (int)(currActor->getX().value);
-				py = (int)(currActor->getY().value);
-			} else {
-				if (abs((int)(currActor->getX().value) - px) < 8 && abs((int)(currActor->getY().value) - py) < 8) {
-					if (currActor->getIsScared()) {
-						// Ghost will perish! Play sound effect, set death
-						setSoundFlag(6, true);
-						currActor->setLife(false);
-						currActor->reset();
-					} else {
-						// Pacman will perish! Play sound effect, set death
-						setSoundFlag(7, true);
-						pacman->setLife(false);
+			// Only pacmen in the squares within reach of this ghost (usually just its own) can overlap it
+			if (!isPacman) {
+				int gx = (int)(currActor->getX());
+				int gy = (int)(currActor->getY());
+				int x0 = screenX2mazeX(gx - 7), x1 = screenX2mazeX(gx + 7);
+				int y0 = screenY2mazeY(gy - 7), y1 = screenY2mazeY(gy + 7);
+				for (int sx = x0; sx <= x1 && currActor->getIsAlive(); sx++) {
+					for (int sy = y0; sy <= y1 && currActor->getIsAlive(); sy++) {
+						int p = pacmanCells->getFirst(sx, sy);
+						while (p != -1 && currActor->getIsAlive()) {
+							int nextP = pacmanCells->getNext(p);
+							vActor * prey = pacmen[p];
+							if (abs(gx - (int)(prey->getX())) < 8 && abs(gy - (int)(prey->getY())) < 8) {
+								if (currActor->getIsScared()) {
+									// Ghost will perish! Play sound effect, set death
+									setSoundFlag(6, true);
+									currActor->setLife(false);
+									currActor->reset();
+									ghostCells->remove(i);
+								} else {
+									// Pacman will perish! Play sound effect, set death
+									setSoundFlag(7, true);
+									prey->setLife(false);
+									pacmanCells->remove(p);
+								}
+							}
+							p = nextP;
+						}
 					}
 				}
 			}
 
 			// Is there a wall in direction of velocity, and are we more than halfway through the cell?
 			// If so, stop and reset to center of cell, facing in same direction but motionless
-			mazeSquare * cell = getSquare(mx, my);
-			if (cell->wallUp && currActor->getVelY() > 0 && fullyEntered) {
+			mazeSquare cell = getSquare(mx, my);
+			if (cell.wallUp && currActor->getVelY() > 0 && fullyEntered) {
 				currActor->setVelY(0.0f);
 				currActor->setY((float)cy);
-			} else if (cell->wallLeft && currActor->getVelX() < 0 && fullyEntered) {
+			} else if (cell.wallLeft && currActor->getVelX() < 0 && fullyEntered) {
 				currActor->setVelX(0.0f);
 				currActor->setX((float)cx);
-			} else if (cell->wallDown && currActor->getVelY() < 0 && fullyEntered) {
+			} else if (cell.wallDown && currActor->getVelY() < 0 && fullyEntered) {
 				currActor->setVelY(0.0f);
 				currActor->setY((float)cy);
-			} else if (cell->wallRight && currActor->getVelX() > 0 && fullyEntered) {
+			} else if (cell.wallRight && currActor->getVelX() > 0 && fullyEntered) {
 				currActor->setVelX(0.0f);
 				currActor->setX((float)cx);
 			}
@@ -1342,55 +1698,46 @@ void vMaze::update(float dt) {
 				currActor->setX((float)cx);
 			}
 
-			if (i == 0) {
+			if (isPacman) {
 				// Check pacman consumption
-				if (items != NULL && !items[mx * numH + my].getIsConsumed() && fullyEntered) {
-					setSoundFlag(1, !getSoundFlag(1) && items[mx * numH + my].getItemType() == IT_SMALL_DOT);
-					setSoundFlag(2, !getSoundFlag(2) && items[mx * numH + my].getItemType() == IT_LARGE_DOT);
-					setSoundFlag(3, !getSoundFlag(3) && !getSoundFlag(1) && !getSoundFlag(2));
-					items[mx * numH + my].consume();
-					if (items[mx * numH + my].getItemType() == IT_LARGE_DOT) {
+				if (!items->getIsConsumed(mx, my) && fullyEntered) {
+					// Sound flags latch until the game plays them; several ticks may run per frame
+					itemType eaten = items->getItemType(mx, my);
+					if (eaten == IT_SMALL_DOT) {
+						setSoundFlag(1, true);
+					} else if (eaten == IT_LARGE_DOT) {
+						setSoundFlag(2, true);
+					} else {
+						setSoundFlag(3, true);
+					}
+					items->consume(mx, my);
+					if (eaten == IT_LARGE_DOT) {
 						// Begin vulnerability! Change ghost sprites, pacman ai
-						blinky->setScared(true);
-						pinky->setScared(true);
-						inky->setScared(true);
-						clyde->setScared(true);
-						pacman->setMode(AI_HOMICIDAL);
+						for (size_t g = 0; g < ghosts.size(); g++) {
+							ghosts[g]->setScared(true);
+						}
+						for (size_t p = 0; p < pacmen.size(); p++) {
+							pacmen[p]->setMode(AI_HOMICIDAL);
+						}
 						setSoundFlag(5, true);
-						time(&lastVulnerability);
+						timers->cancel(vulnerabilityTimer);
+						vulnerabilityTimer = timers->schedule(simTime + vulnerabilityDuration + 0.5 * level, endVulnerability, this, NULL);
 					}
-				} else {
-					setSoundFlag(1, false);
-					setSoundFlag(2, false);
-					setSoundFlag(3, false);
 				}
 
 				// AI time!
-				applyAi(pacman);
+				applyAi(currActor);
 			}
-			currActor->update(dt);
 		}
 	}
 
-	// Check vulnerability countdown
-	time_t currTime;
-	time(&currTime);
-	double dif = difftime(currTime, lastVulnerability);
-	if (dif > vulnerabilityDuration + 0.5 * level) {
-		blinky->setScared(false);
-		pinky->setScared(false);
-		inky->setScared(false);
-		clyde->setScared(false);
-		pacman->setMode(AI_GREEDY);
-	}
+	// Move and animate whoever is still alive, and re-index them so queries between ticks see where they are now
+	actors->integrate(dt);
+	actors->animate(dt);
+	locateActors();
 
-	// Check ability duration (blinky, inky only)
-	if (difftime(currTime, blinky->getAbilityTriggered()) > blinky->getLevel()) {
-		blinky->setVelocity(0.8f * baseVelocity);
-	}
-	if (difftime(currTime, inky->getAbilityTriggered()) > inky->getLevel()) {
-		inky->setScared(blinky->getIsScared());
-	}
+	// Expire vulnerability and abilities that ran out during this tick
+	timers->advance(simTime);
 }
 
 // --- Coordinate Transformations --- //
@@ -3,28 +3,41 @@
 	Maze class
 	Begun Monday, May 3rd, 2010
 
-	The mazeSquare struct defines wall layouts for each square in the maze
+	The mazeSquare struct is a read-only snapshot of the walls and flags around one square in the maze
 
 	The vMaze class defines a maze and many maze-specific mechanics for the game. The maze class includes maze layout
-	(a matrix of mazeSquare objects), maze generation methods, actor instances (ghosts and pacman), items, etc.
+	(bit grids of shared walls and per-square flags), maze generation methods, actor instances (ghosts and pacman),
+	items, etc. It has no graphics dependencies, so whole levels can be simulated headless; see vRenderer for drawing.
 */
 
 #ifndef VENGEANCE_MAZE_H
 #define VENGEANCE_MAZE_H
 
-#include <libArtemis.h>
 #include "Dice.h"
-#include "vItem.h"
+#include "vItemGrid.h"
 #include "vActor.h"
 #include "vSprite.h"
-#include <time.h>
+#include <stddef.h>
+#include <vector>
 
 // Several algorithms are available for maze generation; division is default, biased towards long corridors
 enum MazeAlg { MA_DIVISION, MA_PRIM, MA_KRUSKAL, MA_BACKTRACK };
 
+// Smallest maze the generators can connect: ghost town's row must leave a column to pass it by, and its entrance
+// needs a row beneath it
+#define MAZE_MIN_W 4
+#define MAZE_MIN_H 2
+
 // Basic direction enumerations, up left down right
 enum MazeDirection { MD_NONE, MD_UP, MD_LEFT, MD_DOWN, MD_RIGHT };
 
+class vRouteTable;
+class DisjointSet;
+class BitGrid;
+class vFlood;
+class vTimerWheel;
+class vActorGrid;
+
 struct mazeSquare {
 	// 'true' means a wall exists in that direction
 	bool wallUp;
@@ -32,13 +45,12 @@ struct mazeSquare {
 	bool wallLeft;
 	bool wallRight;
 
-	// These flags are used for recursive iteration when exploring the maze
+	// These flags are used for iteration when exploring the maze
 	bool visited;
 	bool accessible;
 
 	// Methods
 	mazeSquare();
-	void reset(bool empty=true);
 };
 
 class vMaze {
@@ -54,30 +66,75 @@ private:
 	int numEffects;		// Number of sound effects (length of playSnds array)
 	int numW, numH;
 	int dx, dy;
+	unsigned int layoutStamp;	// Bumped whenever walls, dimensions or screen offset change
+	int viewW, viewH;	// Viewport the maze is centered in, in pixels
 	int level;
 	int levelPoints, totalPoints;
+	int vulnerabilityTimer;		// Pending timer handle, or -1
+	uint64_t levelSeed;	// Seed the current level was generated and is being played from
+	bool hasLevelSeed;	// Has the next level's seed been given?
+	int * distances;	// Scratch distance plot for on-demand AI pathing, numW*numH long
+	int * dangerField;	// Maze distance from each square to the nearest living ghost, or -1; numW*numH long
+	int * preyField;	// Maze distance from each square to the nearest living pacman, or -1; numW*numH long
+	bool dangerStale, preyStale;	// Have actors moved since the fields were last checked?
+	std::vector<int> dangerSources;	// Squares each field was plotted from, in slot order; {-1} forces a re-plot
+	std::vector<int> preySources;
+	std::vector<int> fieldSources;	// Scratch list of source squares
+	std::vector<int> searchQueue;	// Scratch for item searches, numW*numH long each
+	std::vector<int> searchDist;
+	std::vector<int> searchStamps;	// Marks squares visited by the current search
+	int searchStamp;
+	float itemWeights[numItemTypes];	// How much greedy pacmen want each item type; 0 ignores it
+	MazeAlg algorithm;				// Generation algorithm used by newLevel
 	double vulnerabilityDuration;	// Length in seconds of vulnerability after big dots are eaten
-	time_t lastVulnerability;		// Unix time of the last vulnerable period, for countdown
+	double simTime;					// Seconds of simulated time; advances only with update()
 
 	// Objects
-	aTexture * textures;
-	Dice * die;
-	mazeSquare * squares;
-	vItem * items;
-	vSprite * wallSegment;
+	Dice * die;			// The maze's own generator; nothing else draws from it
+	BitGrid * vertWalls;		// (numW+1) x numH; bit x,y is the wall on the left side of square x,y
+	BitGrid * horizWalls;		// numW x (numH+1); bit x,y is the wall on the bottom side of square x,y
+	BitGrid * visitedFlags;		// numW x numH
+	BitGrid * accessibleFlags;	// numW x numH
+	BitGrid * reachFlags;		// numW x numH; scratch for accessibility floods
+	vFlood * flood;				// Bit-parallel flood and plot over the wall grids
+	vItemGrid * items;	// Also keeps the running counts and points of this level's items
+	vRouteTable * routes;
+	DisjointSet * regions;	// Connected regions of squares, merged as walls are opened during generation
+	vActorTable * actors;	// State of every actor, field by field; the actors below are handles into it
+	std::vector<vActor *> pacmen;	// Table slots 0..n-1
+	std::vector<vActor *> ghosts;	// The slots after the pacmen; colors cycle red, pink, blue, orange
+	vActorGrid * pacmanCells;	// Living pacmen by square
+	vActorGrid * ghostCells;	// Living ghosts by square
+	vTimerWheel * timers;	// Expiry of timed effects (vulnerability, abilities), on the maze clock
+
+	// Timer callbacks; owner is the maze, subject the affected actor (if any)
+	static void endImmunity(void * owner, void * subject);
+	static void endSprint(void * owner, void * subject);
+	static void endVulnerability(void * owner, void * subject);
 
 	// Maze Creation (private: no or dangerous use externally)
+	bool isGhostTown(int x, int y);
 	void applyAi(vActor * actor);
-	void breakIsolation(int x=-1, int y=-1);		// Ensure all cells are connected to the center
+	void backtrackCarve();
+	void breakIsolation();							// Ensure all cells are connected to the center
+	void placeGhost(int k);							// Start position of the k-th ghost, around the center
+	void releaseActors();
 	void buildGhostTown();
+	void chooseRefuge(vActor * actor, int cx, int cy, int * threat);	// Waypoint as far as possible from the threat
 	void divisionStep(int l, int r, int b, int t);
 	void fillSpaces();
 	void generate(MazeAlg algorithm);
+	void locateActors();							// Refresh actors' squares and the occupancy grids
+	void kruskalCarve();
+	void openWall(int x, int y, MazeDirection direction);
+	void primCarve();
+	void refreshField(int * field, std::vector<int> & sources, int first, int last);	// From living actors in slots first..last-1
 	void refreshAccessibility(int x=-1, int y=-1);	// Set 'accessible' flag for each square, from center outwards
 	void resetAccessibility();
 	void resetSquares(bool empty=true);
 	void resetVisited();
-	void resize(int w, int h, aGraphics * context);
+	void resize(int w, int h);
+	void resizeSquares(int w, int h);
 	void setVertWall(int v);
 	void setVertWall(int x, int y, bool s=true); 	// x is wall location, y is square location
 	void setHorizWall(int h);
@@ -85,6 +142,7 @@ private:
 protected:
 public:
 	// Actors: public because they are stricly not maze elements, but kept in this namespace to avoid global pollution
+	// These are the first pacman and the first ghost of each color; any others are reached through getPacman/getGhost
 	vActor * pacman;
 	vActor * blinky;
 	vActor * pinky;
@@ -96,30 +154,65 @@ public:
 	~vMaze();
 
 	// Accessors
+	MazeAlg getAlgorithm();
 	bool getIsPaused();
 	bool getSoundFlag(int n);
 	int getCurrentPointsTotal();
+	float getItemWeight(itemType t);
+	itemTally getItemTally();	// Per-type breakdown of the current level, for telemetry
+	int * getDangerField();		// Shared by every decision until actors next move; plotted on demand
 	int getLevel();
+	uint64_t getLevelSeed();
 	int getNumH();
 	int getNumW();
+	float getSquareDim();
 	int getTotalPoints();
-	aTexture * getTextures();
-	mazeSquare * getSquare(int x, int y);
+	double getTime();			// Maze clock, in seconds; every gameplay timer is measured against it
+	int getViewH();
+	int getViewW();
+	vRouteTable * getRouteTable();
+	bool getWall(int x, int y, MazeDirection direction);
+	mazeSquare getSquare(int x, int y);
+	size_t getLayoutBytes();
+	unsigned int getLayoutStamp();	// Unchanged stamp means unchanged walls; renderers rebake their wall layer on a change
+	vActor * getActor(int slot);
 	vActor * getActorByType(spriteType actorType);
+	vActor * getGhost(int i);
+	vActor * getPacman(int i);
+	int getNumActors();
+	int getNumAliveGhosts();
+	int getNumAlivePacmen();
+	int getNumGhosts();
+	int getNumPacmen();
+	int * getPreyField();
+	vActorTable * getActorTable();
 	vActor * getSelection();
-	vItem * getItem(int x, int y);
+	vActor * findSelection() const;	// As getSelection, but NULL rather than selecting pacman when nothing is selected
+	vItemGrid * getItems();
+	void setAlgorithm(MazeAlg a);
+	void setItemWeight(itemType t, float w);	// E.g. 2 for a fruit makes it worth a detour of twice its distance
+	void setLevel(int l);		// The next newLevel() (without reset) plays level l+1
+	void setLevelSeed(uint64_t s);
+	void setPopulation(int numPacmen, int numGhosts);	// Replaces every actor; at least 1 pacman and 4 ghosts
+	void setTime(double t);		// Moves the clock, dropping pending timers; for replays, before newLevel()
+	void setSeed(uint64_t s);
 	void setSoundFlag(int n, bool s);
+	void setViewport(int w, int h);
 	void pause();
 	void unpause();
 
 	// Methods
 	bool checkAccessibility();
 	bool executeAbility(vActor * subject);
-	void aStarPlot(int * values, int x, int y); // Plots the distance from x,y to each point in the maze
-	void drawWallSegment(int k, int x, int y, aGraphics * context);
+	bool findItem(int x, int y, int * itemX, int * itemY);	// Best item to head for from square x,y, by weight and maze distance
+	vActor * findNearest(int x, int y, bool findGhost);	// Nearest living ghost (or pacman) to square x,y by maze distance; NULL if none
+	int findNearest(int x, int y, bool findGhost, int k, vActor ** found);	// Up to k of them, nearest first; returns count
+	bool stressTest(int w, int h, MazeAlg a);	// Generate and flood a w x h maze; true if fully accessible, false if too small
+	void aStarPlot(int * values, int x, int y, vFlood * scratch=NULL); // Plots the distance from x,y to each point in the maze (breadth-first)
+	MazeDirection stepTowards(int * values, int cx, int cy); // First step from cx,cy down a distance plot
 	void moveToMazeXY(vActor * actor, int x, int y);
-	void newLevel(aGraphics * context, bool reset=false);
-	void renderMaze(aGraphics * context);
+	void levelUpType(spriteType t);		// Levels up every ghost of the given color
+	void newLevel(bool reset=false);
 	void rotateSelection();
 	void turnActor(vActor * actor, MazeDirection direction);
 	void update(float dt);
@@ -0,0 +1,188 @@
+/*	Brian Kirkpatrick
+	Pac-Man: Vengeance
+	Rasterizer class
+	Begun Saturday, October 17th, 2026
+
+	The rasterizer is the CPU backend for render lists: it draws textured quads and line strips into an RGBA image,
+	so frames can be produced on machines with no GPU or window. The frame is cut into bands of rows, one per thread,
+	and every thread plays the whole list clipped to its band, so threads never touch the same pixels and the result
+	doesn't depend on how many there are.
+
+	Quads sample their texture at the nearest texel and are blended over what's below by their alpha, as the game draws
+	them. Text runs are skipped; there's no font rasterizer outside of Artemis.
+*/
+
+#include "vRasterizer.h"
+#include <math.h>
+#include <string.h>
+#include <thread>
+
+static void blend(unsigned char * dst, const unsigned char * src) {
+	// Source over destination; opaque and empty texels are by far the most common, so they skip the arithmetic
+	unsigned int a = src[3];
+	if (a == 255) {
+		memcpy(dst, src, 4);
+	} else if (a != 0) {
+		unsigned int inv = 255 - a;
+		dst[0] = (unsigned char)((src[0] * a + dst[0] * inv + 127) / 255);
+		dst[1] = (unsigned char)((src[1] * a + dst[1] * inv + 127) / 255);
+		dst[2] = (unsigned char)((src[2] * a + dst[2] * inv + 127) / 255);
+		dst[3] = (unsigned char)(a + (dst[3] * inv + 127) / 255);
+	}
+}
+
+static int clampInt(int v, int lo, int hi) {
+	return v < lo ? lo : (v > hi ? hi : v);
+}
+
+// --- Constructors --- //
+
+vRasterizer::vRasterizer() {
+	numThreads = 0;
+	clearColor[0] = clearColor[1] = clearColor[2] = 0;
+	clearColor[3] = 255;
+}
+
+vRasterizer::~vRasterizer() {
+	// Nothing to destroy; textures belong to the caller
+}
+
+// --- Private Methods --- //
+
+void vRasterizer::drawBand(vRenderList * list, vImage * target, int firstRow, int lastRow) {
+	// Rows firstRow..lastRow (from the top) only
+	int width = target->getWidth();
+	for (int y = firstRow; y <= lastRow; y++) {
+		unsigned char * row = target->getRow(y);
+		for (int x = 0; x < width; x++) {
+			memcpy(row + 4 * x, clearColor, 4);
+		}
+	}
+	for (int i = 0; i < list->getNumCommands(); i++) {
+		const renderCommand & c = list->getCommand(i);
+		switch (c.type) {
+			case RC_QUADS:
+				drawQuads(c, list->getData(c), target, firstRow, lastRow);
+				break;
+			case RC_LINE_STRIP:
+				drawLineStrip(c, list->getData(c), target, firstRow, lastRow);
+				break;
+			case RC_TEXT:
+				break;
+		}
+	}
+}
+
+void vRasterizer::drawLineStrip(const renderCommand & c, const float * points, vImage * target, int firstRow, int lastRow) {
+	// One pixel wide, stepping along the longer axis of each segment
+	int width = target->getWidth();
+	int height = target->getHeight();
+	unsigned char color[4];
+	for (int k = 0; k < 4; k++) {
+		float v = c.color[k] < 0.0f ? 0.0f : (c.color[k] > 1.0f ? 1.0f : c.color[k]);
+		color[k] = (unsigned char)(v * 255.0f + 0.5f);
+	}
+	for (int s = 0; s + 1 < c.count; s++) {
+		float x0 = points[2 * s];
+		float y0 = (float)height - points[2 * s + 1];
+		float x1 = points[2 * s + 2];
+		float y1 = (float)height - points[2 * s + 3];
+		int steps = (int)ceilf(fabsf(x1 - x0) > fabsf(y1 - y0) ? fabsf(x1 - x0) : fabsf(y1 - y0));
+		if (steps < 1) steps = 1;
+		for (int k = 0; k <= steps; k++) {
+			float t = (float)k / (float)steps;
+			int px = (int)floorf(x0 + t * (x1 - x0));
+			int py = (int)floorf(y0 + t * (y1 - y0));
+			if (px < 0 || px >= width || py < firstRow || py > lastRow) continue;
+			blend(target->getRow(py) + 4 * px, color);
+		}
+	}
+}
+
+void vRasterizer::drawQuads(const renderCommand & c, const float * quads, vImage * target, int firstRow, int lastRow) {
+	// A pixel is covered when its center is inside the quad; the quad's top edge maps to texTop
+	if (c.texture < 0 || c.texture >= (int)textures.size() || textures[c.texture] == NULL) return;
+	vImage * texture = textures[c.texture];
+	int texW = texture->getWidth();
+	int texH = texture->getHeight();
+	if (texW <= 0 || texH <= 0) return;
+	int width = target->getWidth();
+	int height = target->getHeight();
+	std::vector<int> texColumns(width > 0 ? width : 1);
+	for (int k = 0; k < c.count; k++) {
+		const float * q = quads + k * quadFloats;
+		float left = q[0], bottom = q[1], right = q[2], top = q[3];
+		if (right <= left || top <= bottom) continue;
+
+		// Covered pixel columns, and rows counted down from the top of the frame
+		int x0 = clampInt((int)ceilf(left - 0.5f), 0, width);
+		int x1 = clampInt((int)ceilf(right - 0.5f), 0, width);
+		int y0 = clampInt((int)ceilf((float)height - top - 0.5f), firstRow, lastRow + 1);
+		int y1 = clampInt((int)ceilf((float)height - bottom - 0.5f), firstRow, lastRow + 1);
+		if (x0 >= x1 || y0 >= y1) continue;
+
+		// Texel columns are the same for every row of the quad
+		float sScale = (q[6] - q[4]) / (right - left);
+		for (int x = x0; x < x1; x++) {
+			float s = q[4] + ((float)x + 0.5f - left) * sScale;
+			texColumns[x] = clampInt((int)floorf(s * (float)texW), 0, texW - 1);
+		}
+		float tScale = (q[7] - q[5]) / (top - bottom);
+		for (int y = y0; y < y1; y++) {
+			float t = q[5] + (top - ((float)height - (float)y - 0.5f)) * tScale;
+			const unsigned char * texRow = texture->getRow(clampInt((int)floorf(t * (float)texH), 0, texH - 1));
+			unsigned char * row = target->getRow(y);
+			for (int x = x0; x < x1; x++) {
+				blend(row + 4 * x, texRow + 4 * texColumns[x]);
+			}
+		}
+	}
+}
+
+// --- Accessors --- //
+
+int vRasterizer::getNumThreads() {
+	return numThreads;
+}
+
+void vRasterizer::setClearColor(unsigned char r, unsigned char g, unsigned char b, unsigned char a) {
+	clearColor[0] = r;
+	clearColor[1] = g;
+	clearColor[2] = b;
+	clearColor[3] = a;
+}
+
+void vRasterizer::setNumThreads(int n) {
+	numThreads = n > 0 ? n : 0;
+}
+
+void vRasterizer::setTexture(int i, vImage * texture) {
+	if (i < 0) return;
+	if (i >= (int)textures.size()) textures.resize(i + 1, NULL);
+	textures[i] = texture;
+}
+
+// --- Methods --- //
+
+void vRasterizer::render(vRenderList * list, vImage * target) {
+	target->resize(list->getWidth(), list->getHeight());
+	int height = target->getHeight();
+	if (height <= 0 || target->getWidth() <= 0) return;
+	int threads = numThreads;
+	if (threads == 0) threads = (int)std::thread::hardware_concurrency();
+	if (threads < 1) threads = 1;
+	if (threads > height) threads = height;
+	if (threads == 1) {
+		drawBand(list, target, 0, height - 1);
+		return;
+	}
+	std::vector<std::thread> pool;
+	for (int t = 0; t < threads; t++) {
+		int firstRow = t * height / threads;
+		int lastRow = (t + 1) * height / threads - 1;
+		pool.push_back(std::thread(&vRasterizer::drawBand, this, list, target, firstRow, lastRow));
+	}
+	for (int t = 0; t < threads; t++) {
+		pool[t].join();
+	}
+}
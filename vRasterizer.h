@@ -0,0 +1,49 @@
+/*	Brian Kirkpatrick
+	Pac-Man: Vengeance
+	Rasterizer class
+	Begun Saturday, October 17th, 2026
+
+	The rasterizer is the CPU backend for render lists: it draws textured quads and line strips into an RGBA image,
+	so frames can be produced on machines with no GPU or window. The frame is cut into bands of rows, one per thread,
+	and every thread plays the whole list clipped to its band, so threads never touch the same pixels and the result
+	doesn't depend on how many there are.
+
+	Quads sample their texture at the nearest texel and are blended over what's below by their alpha, as the game draws
+	them. Text runs are skipped; there's no font rasterizer outside of Artemis.
+*/
+
+#ifndef VENGEANCE_RASTERIZER_H
+#define VENGEANCE_RASTERIZER_H
+
+#include "vImage.h"
+#include "vRenderList.h"
+#include <vector>
+
+class vRasterizer {
+private:
+	// Data
+	int numThreads;
+	unsigned char clearColor[4];
+	std::vector<vImage *> textures;		// Indexed like the list's texture numbers; not owned
+
+	// Methods
+	void drawBand(vRenderList * list, vImage * target, int firstRow, int lastRow);
+	void drawLineStrip(const renderCommand & c, const float * points, vImage * target, int firstRow, int lastRow);
+	void drawQuads(const renderCommand & c, const float * quads, vImage * target, int firstRow, int lastRow);
+protected:
+public:
+	// Constructors
+	vRasterizer();
+	~vRasterizer();
+
+	// Accessors
+	int getNumThreads();
+	void setClearColor(unsigned char r, unsigned char g, unsigned char b, unsigned char a=255);
+	void setNumThreads(int n);				// 0 uses every hardware thread
+	void setTexture(int i, vImage * texture);
+
+	// Methods
+	void render(vRenderList * list, vImage * target);	// Resizes target to the list's size first
+};
+
+#endif
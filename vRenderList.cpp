@@ -0,0 +1,119 @@
+/*	Brian Kirkpatrick
+	Pac-Man: Vengeance
+	Render list class
+	Begun Saturday, October 17th, 2026
+
+	The render list is a frame's drawing recorded as a compact list of commands (runs of textured quads, line strips
+	and text runs) in pixel coordinates, with y up from the bottom of the frame. It has no graphics dependencies;
+	vRenderer plays it back with OpenGL, and vRasterizer draws it into memory on the CPU.
+
+	Quads are axis-aligned, so each is stored as two corners and two texture corners. Consecutive quads from the same
+	texture are merged into one command, which is what lets a backend draw them in a single call.
+*/
+
+#include "vRenderList.h"
+
+// --- Constructors --- //
+
+vRenderList::vRenderList() {
+	width = 0;
+	height = 0;
+}
+
+vRenderList::~vRenderList() {
+	// Nothing to destroy
+}
+
+// --- Accessors --- //
+
+const renderCommand & vRenderList::getCommand(int i) {
+	return commands[i];
+}
+
+const float * vRenderList::getData(const renderCommand & c) {
+	return data.empty() ? NULL : &data[c.first];
+}
+
+const std::string & vRenderList::getString(const renderCommand & c) {
+	return strings[c.first];
+}
+
+int vRenderList::getHeight() {
+	return height;
+}
+
+int vRenderList::getNumCommands() {
+	return (int)commands.size();
+}
+
+int vRenderList::getWidth() {
+	return width;
+}
+
+void vRenderList::setSize(int w, int h) {
+	width = w > 0 ? w : 0;
+	height = h > 0 ? h : 0;
+}
+
+// --- Methods --- //
+
+void vRenderList::addLineStrip(const float * points, int n, float r, float g, float b, float a) {
+	if (n <= 0) return;
+	renderCommand c;
+	c.type = RC_LINE_STRIP;
+	c.texture = -1;
+	c.first = (int)data.size();
+	c.count = n;
+	c.x = c.y = c.size = 0.0f;
+	c.color[0] = r;
+	c.color[1] = g;
+	c.color[2] = b;
+	c.color[3] = a;
+	data.insert(data.end(), points, points + 2 * n);
+	commands.push_back(c);
+}
+
+void vRenderList::addQuad(int texture, float left, float bottom, float right, float top, float texLeft, float texTop, float texRight, float texBottom) {
+	float quad[quadFloats] = { left, bottom, right, top, texLeft, texTop, texRight, texBottom };
+	addQuads(texture, quad, 1);
+}
+
+void vRenderList::addQuads(int texture, const float * quads, int n) {
+	// Extends the last command when it is a run from the same texture, since its data ends where these will start
+	if (n <= 0) return;
+	if (commands.empty() || commands.back().type != RC_QUADS || commands.back().texture != texture) {
+		renderCommand c;
+		c.type = RC_QUADS;
+		c.texture = texture;
+		c.first = (int)data.size();
+		c.count = 0;
+		c.x = c.y = c.size = 0.0f;
+		c.color[0] = c.color[1] = c.color[2] = c.color[3] = 1.0f;
+		commands.push_back(c);
+	}
+	data.insert(data.end(), quads, quads + n * quadFloats);
+	commands.back().count += n;
+}
+
+void vRenderList::addText(const std::string & text, float x, float y, float size, float r, float g, float b) {
+	renderCommand c;
+	c.type = RC_TEXT;
+	c.texture = -1;
+	c.first = (int)strings.size();
+	c.count = 0;
+	c.x = x;
+	c.y = y;
+	c.size = size;
+	c.color[0] = r;
+	c.color[1] = g;
+	c.color[2] = b;
+	c.color[3] = 1.0f;
+	strings.push_back(text);
+	commands.push_back(c);
+}
+
+void vRenderList::clear() {
+	commands.clear();
+	data.clear();
+	strings.clear();
+}
@@ -0,0 +1,64 @@
+/*	Brian Kirkpatrick
+	Pac-Man: Vengeance
+	Render list class
+	Begun Saturday, October 17th, 2026
+
+	The render list is a frame's drawing recorded as a compact list of commands (runs of textured quads, line strips
+	and text runs) in pixel coordinates, with y up from the bottom of the frame. It has no graphics dependencies;
+	vRenderer plays it back with OpenGL, and vRasterizer draws it into memory on the CPU.
+
+	Quads are axis-aligned, so each is stored as two corners and two texture corners. Consecutive quads from the same
+	texture are merged into one command, which is what lets a backend draw them in a single call.
+*/
+
+#ifndef VENGEANCE_RENDER_LIST_H
+#define VENGEANCE_RENDER_LIST_H
+
+#include <string>
+#include <vector>
+
+enum renderCommandType { RC_QUADS, RC_LINE_STRIP, RC_TEXT };
+
+// Floats per quad: left, bottom, right, top, then texture left, top, right, bottom
+static const int quadFloats = 8;
+
+struct renderCommand {
+	renderCommandType type;
+	int texture;	// RC_QUADS: index into the backend's textures
+	int first;		// RC_QUADS, RC_LINE_STRIP: first float of the command's data; RC_TEXT: index of the string
+	int count;		// RC_QUADS: quads; RC_LINE_STRIP: points; RC_TEXT: unused
+	float x, y, size;	// RC_TEXT: baseline origin and font size, in pixels
+	float color[4];	// RC_LINE_STRIP, RC_TEXT
+};
+
+class vRenderList {
+private:
+	// Data
+	int width, height;		// Pixels
+	std::vector<renderCommand> commands;
+	std::vector<float> data;	// Quads and points; kept between frames so the storage is reused
+	std::vector<std::string> strings;
+protected:
+public:
+	// Constructors
+	vRenderList();
+	~vRenderList();
+
+	// Accessors
+	const renderCommand & getCommand(int i);
+	const float * getData(const renderCommand & c);
+	const std::string & getString(const renderCommand & c);
+	int getHeight();
+	int getNumCommands();
+	int getWidth();
+	void setSize(int w, int h);
+
+	// Methods
+	void addLineStrip(const float * points, int n, float r, float g, float b, float a=1.0f);	// n x,y pairs
+	void addQuad(int texture, float left, float bottom, float right, float top, float texLeft, float texTop, float texRight, float texBottom);
+	void addQuads(int texture, const float * quads, int n);	// n quads of quadFloats each
+	void addText(const std::string & text, float x, float y, float size, float r, float g, float b);
+	void clear();		// Keeps the size
+};
+
+#endif
@@ -0,0 +1,131 @@
+/*	Brian Kirkpatrick
+	Pac-Man: Vengeance
+	Renderer class
+	Begun Saturday, October 17th, 2026
+
+	The renderer class draws the simulation core (maze walls, items, actors and free-standing sprites) with Artemis and
+	OpenGL. Drawing is recorded into a render list by a vSceneRecorder and played back on flush: runs of quads go
+	through a sprite batch, line strips and text are drawn as they come. It owns the universal texture map; nothing in
+	the core refers back to it, so the core builds and runs without a window or graphics context.
+*/
+
+#include "vRenderer.h"
+
+// --- Constructors --- //
+
+vRenderer::vRenderer() {
+	list = new vRenderList();
+	recorder = new vSceneRecorder();
+	batch = new vSpriteBatch();
+
+	// Load universal texture map
+	textures = new aTexture[numSceneTextures];
+	textures[ST_MAP].loadFromFile("..\\resources\\textures.png");
+}
+
+vRenderer::~vRenderer() {
+	if (textures != NULL) {
+		delete[] textures;
+		textures = NULL;
+	}
+	if (list != NULL) {
+		delete list;
+		list = NULL;
+	}
+	if (recorder != NULL) {
+		delete recorder;
+		recorder = NULL;
+	}
+	if (batch != NULL) {
+		delete batch;
+		batch = NULL;
+	}
+}
+
+// --- Private Methods --- //
+
+void vRenderer::begin(aGraphics * context) {
+	list->setSize(context->getWidth(), context->getHeight());
+}
+
+// --- Accessors --- //
+
+vSpriteBatch * vRenderer::getBatch() {
+	return batch;
+}
+
+vRenderList * vRenderer::getList() {
+	return list;
+}
+
+aTexture * vRenderer::getTextures() {
+	return textures;
+}
+
+void vRenderer::setAlpha(float a) {
+	recorder->setAlpha(a);
+}
+
+// --- Methods --- //
+
+void vRenderer::flush(aGraphics * context) {
+	// Plays back everything recorded since the last flush; the list is in pixels, GL wants fractions of the screen
+	float screenWidth = (float)context->getWidth();
+	float screenHeight = (float)context->getHeight();
+	for (int i = 0; i < list->getNumCommands(); i++) {
+		const renderCommand & c = list->getCommand(i);
+		const float * d = list->getData(c);
+		switch (c.type) {
+			case RC_QUADS:
+				for (int k = 0; k < c.count; k++) {
+					const float * q = d + k * quadFloats;
+					batch->add(&textures[c.texture], q[0] / screenWidth, q[1] / screenHeight, q[2] / screenWidth, q[3] / screenHeight, q[4], q[5], q[6], q[7]);
+				}
+				break;
+			case RC_LINE_STRIP:
+				batch->flush();
+				glColor4f(c.color[0], c.color[1], c.color[2], c.color[3]);
+				glBegin(GL_LINE_STRIP); {
+					for (int k = 0; k < c.count; k++) {
+						glVertex2f(d[2 * k] / screenWidth, d[2 * k + 1] / screenHeight);
+					}
+				} glEnd();
+				break;
+			case RC_TEXT: {
+				batch->flush();
+				ScreenDimension x = ScreenDimension(); x.unit = UNIT_PIX; x.value = c.x;
+				ScreenDimension y = ScreenDimension(); y.unit = UNIT_PIX; y.value = c.y;
+				float size = context->hTypewriter->getFontSize();
+				context->hTypewriter->setFontSize(c.size);
+				context->hTypewriter->setColor(c.color[0], c.color[1], c.color[2]);
+				context->hTypewriter->moveCursor(x, y);
+				context->hTypewriter->type(kString(list->getString(c).c_str()), context->getWidth(), context->getHeight());
+				context->hTypewriter->setFontSize(size);
+				break;
+			}
+		}
+	}
+	batch->flush();
+	list->clear();
+}
+
+void vRenderer::renderActor(vActor * actor, aGraphics * context) {
+	begin(context);
+	recorder->recordActor(list, actor);
+}
+
+void vRenderer::renderMaze(vMaze * maze, aGraphics * context) {
+	begin(context);
+	recorder->recordMaze(list, maze);
+}
+
+void vRenderer::renderSprite(vSprite * sprite, aGraphics * context) {
+	begin(context);
+	recorder->recordSprite(list, sprite);
+}
+
+void vRenderer::renderText(const char * text, float x, float y, float size, float r, float g, float b, aGraphics * context) {
+	// x, y in pixels from the lower-left corner of the screen
+	begin(context);
+	list->addText(text, x, y, size, r, g, b);
+}
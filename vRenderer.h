@@ -0,0 +1,53 @@
+/*	Brian Kirkpatrick
+	Pac-Man: Vengeance
+	Renderer class
+	Begun Saturday, October 17th, 2026
+
+	The renderer class draws the simulation core (maze walls, items, actors and free-standing sprites) with Artemis and
+	OpenGL. Drawing is recorded into a render list by a vSceneRecorder and played back on flush: runs of quads go
+	through a sprite batch, line strips and text are drawn as they come. It owns the universal texture map; nothing in
+	the core refers back to it, so the core builds and runs without a window or graphics context.
+*/
+
+#ifndef VENGEANCE_RENDERER_H
+#define VENGEANCE_RENDERER_H
+
+#include <libArtemis.h>
+#include "vSprite.h"
+#include "vActor.h"
+#include "vMaze.h"
+#include "vRenderList.h"
+#include "vSceneRecorder.h"
+#include "vSpriteBatch.h"
+
+class vRenderer {
+private:
+	// Data
+	aTexture * textures;		// Indexed by sceneTexture
+	vRenderList * list;			// Everything recorded since the last flush
+	vSceneRecorder * recorder;
+	vSpriteBatch * batch;		// Every run of quads goes through here
+
+	// Methods
+	void begin(aGraphics * context);	// Matches the list to the screen before anything is recorded into it
+protected:
+public:
+	// Constructors
+	vRenderer();
+	~vRenderer();
+
+	// Accessors
+	vSpriteBatch * getBatch();
+	vRenderList * getList();
+	aTexture * getTextures();
+	void setAlpha(float a);
+
+	// Methods
+	void flush(aGraphics * context);	// Rendering is queued until this is called; flush before drawing anything else over it
+	void renderActor(vActor * actor, aGraphics * context);
+	void renderMaze(vMaze * maze, aGraphics * context);
+	void renderSprite(vSprite * sprite, aGraphics * context);
+	void renderText(const char * text, float x, float y, float size, float r, float g, float b, aGraphics * context);
+};
+
+#endif
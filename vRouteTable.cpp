@@ -0,0 +1,173 @@
+/*	Brian Kirkpatrick
+	Pac-Man: Vengeance
+	Route table class
+	Begun Saturday, October 17th, 2026
+
+	The route table class precomputes, for every pair of (square, destination) in a generated maze, the direction of
+	the first step along a shortest path. Each hop is packed into 2 bits, so AI steering becomes a single lookup
+	instead of a fresh distance plot. Two bits leave no room for "no route", so each square also records which
+	connected region it lies in, and pairs in different regions have no hop. Tables larger than the memory cap are not
+	built; callers fall back to plotting.
+*/
+
+#include "vRouteTable.h"
+#include "vFlood.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+// Default cap of 16MB covers mazes up to ~8000 squares
+static const size_t defaultMemoryCap = 16 * 1024 * 1024;
+
+// Mazes smaller than this are plotted on the calling thread; spinning up workers would cost more than it saves
+static const int minThreadedSquares = 1024;
+
+// --- Constructors --- //
+
+vRouteTable::vRouteTable() {
+	isBuilt = false;
+	numW = 0;
+	numH = 0;
+	rowBytes = 0;
+	memoryCap = defaultMemoryCap;
+	hops = NULL;
+	regions = NULL;
+}
+
+vRouteTable::~vRouteTable() {
+	clear();
+}
+
+// --- Accessors --- //
+
+bool vRouteTable::getIsBuilt() {
+	return isBuilt;
+}
+
+size_t vRouteTable::getMemoryCap() {
+	return memoryCap;
+}
+
+size_t vRouteTable::getMemoryUsed() {
+	return isBuilt ? (rowBytes + sizeof(int)) * numW * numH : 0;
+}
+
+MazeDirection vRouteTable::getHop(int x, int y, int destX, int destY) {
+	// Returns the first step from x,y towards destX,destY; MD_NONE if already there, unreachable or out of bounds
+	if (!isBuilt || (x == destX && y == destY)) return MD_NONE;
+	if (x < 0 || x >= numW || y < 0 || y >= numH) return MD_NONE;
+	if (destX < 0 || destX >= numW || destY < 0 || destY >= numH) return MD_NONE;
+	int n = x * numH + y;
+	if (regions[n] != regions[destX * numH + destY]) return MD_NONE;
+	unsigned char packed = hops[(destX * numH + destY) * rowBytes + n / 4];
+	return (MazeDirection)(((packed >> (2 * (n % 4))) & 3) + 1);
+}
+
+void vRouteTable::setMemoryCap(size_t bytes) {
+	// A cap of zero disables the table entirely
+	memoryCap = bytes;
+}
+
+// --- Methods --- //
+
+bool vRouteTable::build(vMaze * maze, int numThreads) {
+	// Builds the table for the maze's current walls; returns false (and leaves the table empty) if over the cap
+	clear();
+	numW = maze->getNumW();
+	numH = maze->getNumH();
+	int numSquares = numW * numH;
+	rowBytes = (numSquares + 3) / 4;
+	if (numSquares <= 0 || (rowBytes + sizeof(int)) * numSquares > memoryCap) {
+		return false;
+	}
+	hops = new unsigned char[rowBytes * numSquares];
+
+	// Label connected regions, one breadth-first sweep each; walls are shared, so reachability is symmetric
+	regions = new int[numSquares];
+	for (int i = 0; i < numSquares; i++) {
+		regions[i] = -1;
+	}
+	int * queue = new int[numSquares];
+	for (int seed = 0; seed < numSquares; seed++) {
+		if (regions[seed] != -1) continue;
+		int head = 0, tail = 0;
+		regions[seed] = seed;
+		queue[tail++] = seed;
+		while (head < tail) {
+			int n = queue[head++];
+			int x = n / numH;
+			int y = n % numH;
+			if (y < numH-1 && !maze->getWall(x, y, MD_UP) && regions[n+1] == -1) { regions[n+1] = seed; queue[tail++] = n+1; }
+			if (x > 0 && !maze->getWall(x, y, MD_LEFT) && regions[n-numH] == -1) { regions[n-numH] = seed; queue[tail++] = n-numH; }
+			if (y > 0 && !maze->getWall(x, y, MD_DOWN) && regions[n-1] == -1) { regions[n-1] = seed; queue[tail++] = n-1; }
+			if (x < numW-1 && !maze->getWall(x, y, MD_RIGHT) && regions[n+numH] == -1) { regions[n+numH] = seed; queue[tail++] = n+numH; }
+		}
+	}
+	delete[] queue;
+
+	// Determine worker count
+	if (numThreads <= 0) {
+		numThreads = (int)std::thread::hardware_concurrency();
+	}
+	if (numThreads <= 0 || numSquares < minThreadedSquares) {
+		numThreads = 1;
+	}
+
+	// Each worker claims destinations until none remain, plotting distances outwards from each one
+	std::atomic<int> nextDest(0);
+	int w = numW, h = numH;
+	size_t stride = rowBytes;
+	unsigned char * table = hops;
+	auto worker = [maze, w, h, stride, table, &nextDest]() {
+		int n = w * h;
+		int * values = new int[n];
+		vFlood * scratch = new vFlood();
+		int dest;
+		while ((dest = nextDest.fetch_add(1)) < n) {
+			for (int i = 0; i < n; i++) {
+				values[i] = -1;
+			}
+			values[dest] = 0;
+			maze->aStarPlot(values, dest / h, dest % h, scratch);
+
+			// Pack the first step from every square; the destination itself, and squares that can't reach it, store a
+			// placeholder that getHop() never returns
+			unsigned char * row = table + dest * stride;
+			for (size_t b = 0; b < stride; b++) {
+				row[b] = 0;
+			}
+			for (int i = 0; i < n; i++) {
+				MazeDirection step = i == dest ? MD_NONE : maze->stepTowards(values, i / h, i % h);
+				int code = step == MD_NONE ? 0 : (int)step - 1;
+				row[i / 4] |= (unsigned char)(code << (2 * (i % 4)));
+			}
+		}
+		delete[] values;
+		delete scratch;
+	};
+	if (numThreads == 1) {
+		worker();
+	} else {
+		std::vector<std::thread> workers;
+		for (int i = 0; i < numThreads; i++) {
+			workers.push_back(std::thread(worker));
+		}
+		for (size_t i = 0; i < workers.size(); i++) {
+			workers[i].join();
+		}
+	}
+	isBuilt = true;
+	return true;
+}
+
+void vRouteTable::clear() {
+	if (hops != NULL) {
+		delete[] hops;
+		hops = NULL;
+	}
+	if (regions != NULL) {
+		delete[] regions;
+		regions = NULL;
+	}
+	isBuilt = false;
+}
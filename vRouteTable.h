@@ -0,0 +1,46 @@
+/*	Brian Kirkpatrick
+	Pac-Man: Vengeance
+	Route table class
+	Begun Saturday, October 17th, 2026
+
+	The route table class precomputes, for every pair of (square, destination) in a generated maze, the direction of
+	the first step along a shortest path. Each hop is packed into 2 bits, so AI steering becomes a single lookup
+	instead of a fresh distance plot. Two bits leave no room for "no route", so each square also records which
+	connected region it lies in, and pairs in different regions have no hop. Tables larger than the memory cap are not
+	built; callers fall back to plotting.
+*/
+
+#ifndef VENGEANCE_ROUTE_TABLE_H
+#define VENGEANCE_ROUTE_TABLE_H
+
+#include "vMaze.h"
+#include <stddef.h>
+
+class vRouteTable {
+private:
+	// Data
+	bool isBuilt;
+	int numW, numH;
+	size_t rowBytes;	// Bytes per destination row; rows are padded so threads never share a byte
+	size_t memoryCap;	// Largest table (in bytes) that will be built
+	unsigned char * hops;
+	int * regions;		// Connected region of each square; squares in different regions have no route
+protected:
+public:
+	// Constructors
+	vRouteTable();
+	~vRouteTable();
+
+	// Accessors
+	bool getIsBuilt();
+	size_t getMemoryCap();
+	size_t getMemoryUsed();
+	MazeDirection getHop(int x, int y, int destX, int destY);	// MD_NONE if already there, or unreachable
+	void setMemoryCap(size_t bytes);
+
+	// Methods
+	bool build(vMaze * maze, int numThreads=0);	// One breadth-first plot per destination, spread across threads
+	void clear();
+};
+
+#endif
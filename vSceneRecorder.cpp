@@ -0,0 +1,254 @@
+/*	Brian Kirkpatrick
+	Pac-Man: Vengeance
+	Scene recorder class
+	Begun Saturday, October 17th, 2026
+
+	The scene recorder turns the simulation core (maze walls, items, actors and free-standing sprites) into render list
+	commands, working out which cell of the universal texture map each one uses and where it goes on screen. It has no
+	graphics dependencies, so frames can be recorded headless and drawn by whichever backend is at hand.
+
+	Maze elements are placed through a vCamera, which follows the selection across mazes larger than the list, and
+	only what the camera can see is recorded, so the cost of a frame follows the size of the screen rather than the
+	maze. Free-standing sprites are interface elements and stay in screen pixels.
+*/
+
+#include "vSceneRecorder.h"
+
+const float spriteTex = 0.0625f;
+
+// --- Constructors --- //
+
+vSceneRecorder::vSceneRecorder() {
+	alpha = 1.0f;
+	bakedMaze = NULL;
+	bakedStamp = 0;
+	bakedX0 = bakedY0 = 0;
+	bakedX1 = bakedY1 = -1;
+	camera = new vCamera();
+}
+
+vSceneRecorder::~vSceneRecorder() {
+	if (camera != NULL) {
+		delete camera;
+		camera = NULL;
+	}
+}
+
+// --- Private Methods --- //
+
+void vSceneRecorder::bakeWalls(vMaze * maze, int x0, int y0, int x1, int y1) {
+	// Works out the segment at each intersection in view; intersections are the lower-left corners of squares. Only
+	// the view is covered, so baking costs the same however large the maze is.
+	wallKeys.resize((size_t)(x1 - x0 + 1) * (y1 - y0 + 1));
+	unsigned char * k = wallKeys.empty() ? NULL : &wallKeys[0];
+	for (int i = x0; i <= x1; i++) {
+		for (int j = y0; j <= y1; j++) {
+			*k++ = (unsigned char)getWallKey(maze, i, j);
+		}
+	}
+	bakedMaze = maze;
+	bakedStamp = maze->getLayoutStamp();
+	bakedX0 = x0;
+	bakedY0 = y0;
+	bakedX1 = x1;
+	bakedY1 = y1;
+}
+
+void vSceneRecorder::recordCell(vRenderList * list, float x, float y, float w, float h, bool isCentered, int column, int row) {
+	// The texture map cell at column, row over the given pixel rectangle
+	if (isCentered) {
+		x -= 0.5f * w;
+		y -= 0.5f * h;
+	}
+	float texLeft = spriteTex * (float)column;
+	float texTop = spriteTex * (float)row;
+	list->addQuad(ST_MAP, x, y, x + w, y + h, texLeft, texTop, texLeft + spriteTex, texTop + spriteTex);
+}
+
+int vSceneRecorder::getWallKey(vMaze * maze, int i, int j) {
+	// Texture key of the segment at intersection i, j. 9 possible states: 4 corners, 4 walls, and interior intersections
+	int numW = maze->getNumW();
+	int numH = maze->getNumH();
+	if (i == 0) {
+		if (j == 0) {
+			// Bottom-left corner
+			return 9;
+		} else if (j == numH) {
+			// Top-left corner
+			return 12;
+		} else {
+			// Left wall
+			return maze->getWall(i, j, MD_DOWN) ? 13 : 5;
+		}
+	} else if (i == numW) {
+		if (j == 0) {
+			// Bottom-right corner
+			return 3;
+		} else if (j == numH) {
+			// Top-right corner
+			return 6;
+		} else {
+			// Right wall
+			return maze->getWall(i-1, j, MD_DOWN) ? 7 : 5;
+		}
+	} else {
+		if (j == 0) {
+			// Bottom wall
+			return maze->getWall(i, j, MD_LEFT) ? 11 : 10;
+		} else if (j == numH) {
+			// Top wall
+			return maze->getWall(i-1, j-1, MD_RIGHT) ? 14 : 10;
+		} else {
+			// Interior intersection
+			return 1 * (int)maze->getWall(i, j, MD_LEFT) + 2 * (int)maze->getWall(i-1, j-1, MD_UP) + 4 * (int)maze->getWall(i-1, j-1, MD_RIGHT) + 8 * (int)maze->getWall(i, j, MD_DOWN);
+		}
+	}
+}
+
+// --- Accessors --- //
+
+float vSceneRecorder::getAlpha() {
+	return alpha;
+}
+
+vCamera * vSceneRecorder::getCamera() {
+	return camera;
+}
+
+void vSceneRecorder::setAlpha(float a) {
+	alpha = a < 0.0f ? 0.0f : (a > 1.0f ? 1.0f : a);
+}
+
+// --- Methods --- //
+
+void vSceneRecorder::recordActor(vRenderList * list, vActor * actor) {
+	// Scared actors use the scared texture row; selected actors get a box in their own color
+	if (!actor->getIsAlive() || !actor->getIsVisible()) return;
+	int currType = actor->getIsScared() ? (int)V_SCARED_G : (int)actor->getType();
+	float x = actor->getPrevX() + alpha * (actor->getX() - actor->getPrevX());
+	float y = actor->getPrevY() + alpha * (actor->getY() - actor->getPrevY());
+	float left = x;
+	float bottom = y;
+	if (actor->getIsCentered()) {
+		left -= 0.5f * actor->getW();
+		bottom -= 0.5f * actor->getH();
+	}
+	float right = left + actor->getW();
+	float top = bottom + actor->getH();
+	float marginX = 0.005f * (float)list->getWidth();
+	float marginY = 0.005f * (float)list->getHeight();
+	if (!camera->getIsVisible(left - marginX, bottom - marginY, right + marginX, top + marginY)) return;
+	left += camera->getOffsetX();
+	right += camera->getOffsetX();
+	bottom += camera->getOffsetY();
+	top += camera->getOffsetY();
+	recordCell(list, left, bottom, actor->getW(), actor->getH(), false, (int)actor->getState(), currType);
+
+	// Selection box, with a margin of half a percent of the screen
+	if (actor->getIsSelected()) {
+		float box[10] = { left - marginX, bottom - marginY, right + marginX, bottom - marginY, right + marginX, top + marginY,
+			left - marginX, top + marginY, left - marginX, bottom - marginY };
+		switch (actor->getType()) {
+			case V_RED_G:
+				list->addLineStrip(box, 5, 1.0f, 0.0f, 0.0f);
+				break;
+			case V_BLUE_G:
+				list->addLineStrip(box, 5, 0.0f, 1.0f, 0.871f);
+				break;
+			case V_ORANGE_G:
+				list->addLineStrip(box, 5, 1.0f, 0.722f, 0.278f);
+				break;
+			case V_PINK_G:
+				list->addLineStrip(box, 5, 1.0f, 0.722f, 0.871f);
+				break;
+			default:
+				list->addLineStrip(box, 5, 0.0f, 0.0f, 0.0f);
+				break;
+		}
+	}
+}
+
+void vSceneRecorder::recordItems(vRenderList * list, vMaze * maze) {
+	// One 20x20 quad per uneaten square in view, straight from the item grid; items pick their texture column by item
+	// type, rather than by animation state
+	vItemGrid * items = maze->getItems();
+	float squareDim = maze->getSquareDim();
+	int x0, y0, x1, y1;
+	camera->getVisibleSquares(maze, &x0, &y0, &x1, &y1);
+	for (int i = x0; i <= x1; i++) {
+		float x = (float)(maze->mazeX2screenX(i) - (int)(0.5f * squareDim) + 10) + camera->getOffsetX();
+		for (int j = y0; j <= y1; j++) {
+			if (items->getIsConsumed(i, j)) continue;
+			float y = (float)(maze->mazeY2screenY(j) - (int)(0.5f * squareDim) + 10) + camera->getOffsetY();
+			recordCell(list, x, y, 20.0f, 20.0f, false, (int)items->getItemType(i, j), (int)V_CONSUMABLE);
+		}
+	}
+}
+
+void vSceneRecorder::recordMaze(vRenderList * list, vMaze * maze) {
+	camera->setView(list->getWidth(), list->getHeight());
+	camera->follow(maze, alpha);
+	recordWalls(list, maze);
+
+	// Items on top; should be 1 in each square
+	recordItems(list, maze);
+
+	// Actors (ghosts, then pacmen on top)
+	for (int i = 0; i < maze->getNumGhosts(); i++) {
+		recordActor(list, maze->getGhost(i));
+	}
+	for (int i = 0; i < maze->getNumPacmen(); i++) {
+		recordActor(list, maze->getPacman(i));
+	}
+}
+
+void vSceneRecorder::recordSprite(vRenderList * list, vSprite * sprite) {
+	if (!sprite->getIsVisible()) return;
+	recordCell(list, sprite->getX(), sprite->getY(), sprite->getW(), sprite->getH(), sprite->getIsCentered(), (int)sprite->getState(), (int)sprite->getType());
+}
+
+void vSceneRecorder::recordWallSegment(vRenderList * list, vMaze * maze, int k, int x, int y) {
+	// Segment at maze intersection x, y using texture key k; intersections are the lower-left corners of squares
+	float squareDim = maze->getSquareDim();
+	float screenX = (float)(maze->mazeX2screenX(x) - (int)squareDim) + camera->getOffsetX();
+	float screenY = (float)(maze->mazeY2screenY(y) - (int)squareDim) + camera->getOffsetY();
+	recordCell(list, screenX, screenY, squareDim, squareDim, false, k, (int)V_WALLS);
+}
+
+void vSceneRecorder::recordWalls(vRenderList * list, vMaze * maze) {
+	// Walls only change when a level is generated (or the maze is resized), so the segments in view are worked out
+	// once and kept until the layout changes or the camera brings other squares into view. They are laid out as
+	// quads each frame and go into the list in one run, which items then extend, as they share the texture map.
+	// Intersection i is the lower-left corner of square i, so the squares in view need intersections x0..x1+1.
+	int x0, y0, x1, y1;
+	camera->getVisibleSquares(maze, &x0, &y0, &x1, &y1);
+	x1++;
+	y1++;
+	if (x1 < x0 || y1 < y0) return;
+	if (maze != bakedMaze || maze->getLayoutStamp() != bakedStamp || x0 != bakedX0 || y0 != bakedY0 || x1 != bakedX1 || y1 != bakedY1) {
+		bakeWalls(maze, x0, y0, x1, y1);
+	}
+
+	float squareDim = maze->getSquareDim();
+	visibleQuads.resize(wallKeys.size() * quadFloats);
+	float * q = &visibleQuads[0];
+	const unsigned char * k = &wallKeys[0];
+	float texTop = spriteTex * (float)V_WALLS;
+	for (int i = x0; i <= x1; i++) {
+		float left = (float)(maze->mazeX2screenX(i) - (int)squareDim) + camera->getOffsetX();
+		for (int j = y0; j <= y1; j++) {
+			float bottom = (float)(maze->mazeY2screenY(j) - (int)squareDim) + camera->getOffsetY();
+			float texLeft = spriteTex * (float)*k++;
+			q[0] = left;
+			q[1] = bottom;
+			q[2] = left + squareDim;
+			q[3] = bottom + squareDim;
+			q[4] = texLeft;
+			q[5] = texTop;
+			q[6] = texLeft + spriteTex;
+			q[7] = texTop + spriteTex;
+			q += quadFloats;
+		}
+	}
+	list->addQuads(ST_MAP, &visibleQuads[0], (int)(visibleQuads.size() / quadFloats));
+}
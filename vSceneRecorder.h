@@ -0,0 +1,71 @@
+/*	Brian Kirkpatrick
+	Pac-Man: Vengeance
+	Scene recorder class
+	Begun Saturday, October 17th, 2026
+
+	The scene recorder turns the simulation core (maze walls, items, actors and free-standing sprites) into render list
+	commands, working out which cell of the universal texture map each one uses and where it goes on screen. It has no
+	graphics dependencies, so frames can be recorded headless and drawn by whichever backend is at hand.
+
+	Maze elements are placed through a vCamera, which follows the selection across mazes larger than the list, and
+	only what the camera can see is recorded, so the cost of a frame follows the size of the screen rather than the
+	maze. Free-standing sprites are interface elements and stay in screen pixels.
+*/
+
+#ifndef VENGEANCE_SCENE_RECORDER_H
+#define VENGEANCE_SCENE_RECORDER_H
+
+#include "vActor.h"
+#include "vCamera.h"
+#include "vMaze.h"
+#include "vRenderList.h"
+#include "vSprite.h"
+#include <vector>
+
+// Percent of texture taken up by single sprite
+extern const float spriteTex;
+
+// Textures commands refer to, by index; backends load them in this order
+enum sceneTexture { ST_MAP };
+static const int numSceneTextures = 1;
+
+class vSceneRecorder {
+private:
+	// Data
+	float alpha;		// Progress from the previous simulation tick to the latest one; moving actors are blended
+
+	// Baked wall layer: the segment texture key at each intersection in view, column by column
+	std::vector<unsigned char> wallKeys;
+	vMaze * bakedMaze;			// What the wall layer was baked from; rebaked when any of these change
+	unsigned int bakedStamp;
+	int bakedX0, bakedY0, bakedX1, bakedY1;		// Intersections covered, inclusive
+	std::vector<float> visibleQuads;	// Scratch; the wall quads in view, copied into the list in one run
+
+	// Objects
+	vCamera * camera;
+
+	// Methods
+	void bakeWalls(vMaze * maze, int x0, int y0, int x1, int y1);
+	void recordCell(vRenderList * list, float x, float y, float w, float h, bool isCentered, int column, int row);
+	int getWallKey(vMaze * maze, int i, int j);
+protected:
+public:
+	// Constructors
+	vSceneRecorder();
+	~vSceneRecorder();
+
+	// Accessors
+	float getAlpha();
+	vCamera * getCamera();
+	void setAlpha(float a);
+
+	// Methods
+	void recordActor(vRenderList * list, vActor * actor);		// Through the camera, if in view
+	void recordItems(vRenderList * list, vMaze * maze);		// Every uneaten item in view, by square
+	void recordMaze(vRenderList * list, vMaze * maze);		// Moves the camera; walls, then items, then ghosts, then pacmen
+	void recordSprite(vRenderList * list, vSprite * sprite);
+	void recordWallSegment(vRenderList * list, vMaze * maze, int k, int x, int y);
+	void recordWalls(vRenderList * list, vMaze * maze);		// The segments in view, baked once per layout and view
+};
+
+#endif
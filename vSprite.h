@@ -3,15 +3,14 @@
 	Sprite class
 	Begun Monday, May 3rd, 2010
 
-	The sprite class, extending the panel class, represents a moving object within the maze with a specific state
-	and a type that determine which segment of the universal texture map will be used to render the 2d element.
+	The sprite class represents a moving object within the maze with a pixel position, a specific state and a type
+	that together determine its animation and which segment of the universal texture map is used to render it. Sprites
+	carry no graphics state of their own; see vRenderer for drawing.
 */
 
 #ifndef VENGEANCE_SPRITE_H
 #define VENGEANCE_SPRITE_H
 
-#include <libArtemis.h>
-
 // Sprite type dteremines roll and row within texture map
 enum spriteType { V_PACMAN, V_RED_G, V_PINK_G, V_BLUE_G, V_ORANGE_G, V_SCARED_G, V_WALLS, V_CONSUMABLE };
 
@@ -19,29 +18,41 @@ enum spriteType { V_PACMAN, V_RED_G, V_PINK_G, V_BLUE_G, V_ORANGE_G, V_SCARED_G,
 enum spriteState { SS_NA, SS_UP1, SS_UP2, SS_UP3, SS_DOWN1, SS_DOWN2, SS_DOWN3, SS_LEFT1, SS_LEFT2, SS_LEFT3, SS_RIGHT1, SS_RIGHT2, SS_RIGHT3, SS_SPEC1, SS_SPEC2, SS_SPEC3 };
 
 // Global variables used to tune parameters
-static float spriteDim = 32.0f;
-static float spriteTex = 0.0625f; // Percent of texture taken up by single sprite
-static float baseVelocity = 100.0f; // Pixels / second
-static float animationPeriod = 0.66f; // Number of seconds per animation cycle
-static float animationRatio = 0.33f; // Proportion of non-centered to centered sprite time in animation cycle
+static const float spriteDim = 32.0f;
+static const float baseVelocity = 100.0f; // Pixels / second
+static const float animationPeriod = 0.66f; // Number of seconds per animation cycle
+static const float animationRatio = 0.33f; // Proportion of non-centered to centered sprite time in animation cycle
 
-class vSprite : public aPanel {
+class vSprite {
 private:
 protected:
 	// Data
+	float x, y;		// Pixels
+	float prevX, prevY;	// Position as of the previous simulation tick, for interpolated drawing
+	float w, h;		// Pixels
 	float timeSeed;
 	float xVel; // Pixels / second
 	float yVel; // Pixels / second
+	bool isCentered;	// Is x,y the center of the sprite, or its lower-left corner?
+	bool isVisible;
 	spriteState state;
 	spriteType type;
 public:
 	// Constructors
-	vSprite(aTexture * texture);
-	~vSprite();
+	vSprite();
+	virtual ~vSprite();
 
 	// Retrievers
+	float getX();
+	float getY();
+	float getW();
+	float getH();
+	float getPrevX();
+	float getPrevY();
 	float getVelX();
 	float getVelY();
+	bool getIsCentered();
+	bool getIsVisible();
 	spriteState getState();
 	spriteType getType();
 
@@ -51,14 +62,23 @@ public:
 	void setTimeSeed(float t);
 	void setVelX(float v);
 	void setVelY(float v);
+	void setVisible(bool v);
+	void setX(float px);
+	void setY(float py);
+	void setW(float pw);
+	void setH(float ph);
 
 	// Overridden & Virtual Methods
-	virtual void render(aGraphics * context);
 	virtual void setType(spriteType t);
 	virtual void update(float dt);
 
 	// Methods
-	void moveToPix(int px, int py);
+	void moveToPix(int px, int py);	// Jumps straight there, with no interpolation from the old position
+	void savePosition();			// Marks the start of a simulation tick
+
+	// Shared with actors, whose state lives in vActorTable
+	static bool heading(spriteState s, float & vx, float & vy);	// Velocity implied by a state; false leaves it as is
+	static spriteState animate(spriteState s, float t);			// Animation frame of a state, t seconds into the cycle
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,74 @@
+/*	Brian Kirkpatrick
+	Pac-Man: Vengeance
+	Sprite batch class
+	Begun Saturday, October 17th, 2026
+
+	The sprite batch collects textured quads (screen-relative corners plus texture coordinates) into one streaming
+	vertex array, and draws them on flush with one call per run of quads that share a texture. Quads go out in the
+	order they were added, so overlapping sprites stack exactly as if each had been drawn on its own.
+*/
+
+#include "vSpriteBatch.h"
+
+// --- Constructors --- //
+
+vSpriteBatch::vSpriteBatch() {
+	numDrawCalls = 0;
+}
+
+vSpriteBatch::~vSpriteBatch() {
+	// Nothing to destroy
+}
+
+// --- Accessors --- //
+
+int vSpriteBatch::getNumDrawCalls() {
+	return numDrawCalls;
+}
+
+int vSpriteBatch::getNumQueued() {
+	return (int)(verts.size() / 16);
+}
+
+// --- Methods --- //
+
+void vSpriteBatch::add(aTexture * texture, float left, float bottom, float right, float top, float texLeft, float texTop, float texRight, float texBottom) {
+	// Same corner order and texture mapping as a single GL_QUADS quad: bottom-left, bottom-right, top-right, top-left
+	if (runs.empty() || runs.back().texture != texture) {
+		run r;
+		r.texture = texture;
+		r.first = (int)(verts.size() / 4);
+		r.count = 0;
+		runs.push_back(r);
+	}
+	float quad[16] = { texLeft, texBottom, left, bottom,
+		texRight, texBottom, right, bottom,
+		texRight, texTop, right, top,
+		texLeft, texTop, left, top };
+	verts.insert(verts.end(), quad, quad + 16);
+	runs.back().count += 4;
+}
+
+void vSpriteBatch::flush() {
+	// Untinted, textured quads; the arrays are only enabled for the duration of the flush
+	if (verts.empty()) return;
+	glColor4f(1.0f, 1.0f, 1.0f, 1.0f);
+	glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+	glEnableClientState(GL_VERTEX_ARRAY);
+	glTexCoordPointer(2, GL_FLOAT, 4 * sizeof(float), &verts[0]);
+	glVertexPointer(2, GL_FLOAT, 4 * sizeof(float), &verts[2]);
+	for (size_t i = 0; i < runs.size(); i++) {
+		runs[i].texture->bind();
+		glDrawArrays(GL_QUADS, runs[i].first, runs[i].count);
+		runs[i].texture->unbind();
+		numDrawCalls++;
+	}
+	glDisableClientState(GL_VERTEX_ARRAY);
+	glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+	verts.clear();
+	runs.clear();
+}
+
+void vSpriteBatch::resetStats() {
+	numDrawCalls = 0;
+}
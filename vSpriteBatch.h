@@ -0,0 +1,44 @@
+/*	Brian Kirkpatrick
+	Pac-Man: Vengeance
+	Sprite batch class
+	Begun Saturday, October 17th, 2026
+
+	The sprite batch collects textured quads (screen-relative corners plus texture coordinates) into one streaming
+	vertex array, and draws them on flush with one call per run of quads that share a texture. Quads go out in the
+	order they were added, so overlapping sprites stack exactly as if each had been drawn on its own.
+*/
+
+#ifndef VENGEANCE_SPRITE_BATCH_H
+#define VENGEANCE_SPRITE_BATCH_H
+
+#include <libArtemis.h>
+#include <vector>
+
+class vSpriteBatch {
+private:
+	// Data
+	struct run {
+		aTexture * texture;
+		int first;		// First vertex
+		int count;		// Vertices, 4 per quad
+	};
+	std::vector<float> verts;	// Interleaved s,t,x,y; kept between flushes so the storage is reused
+	std::vector<run> runs;
+	int numDrawCalls;			// Since the last resetStats()
+protected:
+public:
+	// Constructors
+	vSpriteBatch();
+	~vSpriteBatch();
+
+	// Accessors
+	int getNumDrawCalls();
+	int getNumQueued();			// Quads waiting for the next flush
+
+	// Methods
+	void add(aTexture * texture, float left, float bottom, float right, float top, float texLeft, float texTop, float texRight, float texBottom);
+	void flush();
+	void resetStats();
+};
+
+#endif
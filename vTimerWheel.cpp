@@ -0,0 +1,171 @@
+/*	Brian Kirkpatrick
+	Pac-Man: Vengeance
+	Timer wheel class
+	Begun Saturday, October 17th, 2026
+
+	The timer wheel schedules callbacks against the maze clock. Timers are kept in four levels of 64 slots each; the
+	first level holds timers due within 64 ticks, one slot per tick, and each higher level covers 64 times the span
+	of the one below. As time advances, the slots of a higher level are cascaded down into finer ones, so each tick
+	costs one slot (plus whatever timers actually expire) no matter how many timers are pending. Timers are pooled
+	and linked into their slots, so scheduling and cancelling are constant time as well.
+*/
+
+#include "vTimerWheel.h"
+#include <math.h>
+
+static const int slotBits = 6;
+static const int numSlots = 1 << slotBits;
+static const int numLevels = 4;
+static const int handleBits = 8;	// Low bits of a handle hold the timer's generation
+
+// --- Constructors --- //
+
+vTimerWheel::vTimerWheel(double tick) {
+	tickLength = tick > 0.0 ? tick : 0.01;
+	currentTick = 0;
+	numPending = 0;
+	freeList = -1;
+	for (int i = 0; i < numLevels * numSlots; i++) {
+		heads[i] = -1;
+	}
+}
+
+vTimerWheel::~vTimerWheel() {
+	// Nodes are freed with the pool
+}
+
+// --- Private Methods --- //
+
+void vTimerWheel::cascade(int level) {
+	// Moves every timer in the current slot of the given level down into finer slots
+	int slot = level * numSlots + (int)((currentTick >> (slotBits * level)) & (numSlots - 1));
+	int n = heads[slot];
+	heads[slot] = -1;
+	while (n != -1) {
+		int next = nodes[n].next;
+		link(n);
+		n = next;
+	}
+}
+
+void vTimerWheel::link(int n) {
+	// Files the timer under the finest level whose span reaches its expiry
+	long long delta = nodes[n].expiry - currentTick;
+	int level = 0;
+	while (level < numLevels - 1 && delta >= ((long long)1 << (slotBits * (level + 1)))) {
+		level++;
+	}
+	long long expiry = nodes[n].expiry;
+	if (level == numLevels - 1 && delta >= ((long long)1 << (slotBits * numLevels))) {
+		// Beyond the wheel; park it as far out as possible, and it will be re-filed as it cascades down
+		expiry = currentTick + ((long long)1 << (slotBits * numLevels)) - 1;
+	}
+	int slot = level * numSlots + (int)((expiry >> (slotBits * level)) & (numSlots - 1));
+	nodes[n].slot = slot;
+	nodes[n].prev = -1;
+	nodes[n].next = heads[slot];
+	if (heads[slot] != -1) nodes[heads[slot]].prev = n;
+	heads[slot] = n;
+}
+
+void vTimerWheel::unlink(int n) {
+	int slot = nodes[n].slot;
+	if (nodes[n].prev != -1) {
+		nodes[nodes[n].prev].next = nodes[n].next;
+	} else {
+		heads[slot] = nodes[n].next;
+	}
+	if (nodes[n].next != -1) nodes[nodes[n].next].prev = nodes[n].prev;
+}
+
+void vTimerWheel::release(int n) {
+	nodes[n].slot = -1;
+	nodes[n].generation++;
+	nodes[n].next = freeList;
+	freeList = n;
+	numPending--;
+}
+
+// --- Accessors --- //
+
+int vTimerWheel::getNumPending() {
+	return numPending;
+}
+
+double vTimerWheel::getTickLength() {
+	return tickLength;
+}
+
+// --- Methods --- //
+
+bool vTimerWheel::cancel(int handle) {
+	if (handle < 0) return false;
+	int n = handle >> handleBits;
+	if (n >= (int)nodes.size() || nodes[n].slot == -1) return false;
+	if ((nodes[n].generation & ((1 << handleBits) - 1)) != (handle & ((1 << handleBits) - 1))) return false;
+	unlink(n);
+	release(n);
+	return true;
+}
+
+int vTimerWheel::schedule(double when, timerCallback callback, void * owner, void * subject) {
+	// Expiry is rounded up to the next whole tick, and is never sooner than the next tick
+	int n = freeList;
+	if (n != -1) {
+		freeList = nodes[n].next;
+	} else {
+		n = (int)nodes.size();
+		timerNode node;
+		node.generation = 0;
+		nodes.push_back(node);
+	}
+	long long expiry = (long long)floor(when / tickLength) + 1;
+	if (expiry <= currentTick) expiry = currentTick + 1;
+	nodes[n].expiry = expiry;
+	nodes[n].callback = callback;
+	nodes[n].owner = owner;
+	nodes[n].subject = subject;
+	link(n);
+	numPending++;
+	return (n << handleBits) | (nodes[n].generation & ((1 << handleBits) - 1));
+}
+
+void vTimerWheel::advance(double time) {
+	long long target = (long long)floor(time / tickLength);
+	while (currentTick < target) {
+		currentTick++;
+
+		// Whenever a level wraps around, the next level's current slot comes due for refiling
+		for (int level = 1; level < numLevels; level++) {
+			if ((currentTick & (((long long)1 << (slotBits * level)) - 1)) != 0) break;
+			cascade(level);
+		}
+
+		// Fire everything in this tick's slot; callbacks may schedule more timers, always in later slots
+		int slot = (int)(currentTick & (numSlots - 1));
+		while (heads[slot] != -1) {
+			int n = heads[slot];
+			unlink(n);
+			timerCallback callback = nodes[n].callback;
+			void * owner = nodes[n].owner;
+			void * subject = nodes[n].subject;
+			release(n);
+			callback(owner, subject);
+		}
+	}
+}
+
+void vTimerWheel::clear() {
+	for (int n = 0; n < (int)nodes.size(); n++) {
+		if (nodes[n].slot != -1) {
+			unlink(n);
+			release(n);
+		}
+	}
+}
+
+void vTimerWheel::reset(double time) {
+	// With nothing pending, no slot depends on the old tick
+	clear();
+	currentTick = (long long)floor(time / tickLength);
+}
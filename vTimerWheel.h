@@ -0,0 +1,64 @@
+/*	Brian Kirkpatrick
+	Pac-Man: Vengeance
+	Timer wheel class
+	Begun Saturday, October 17th, 2026
+
+	The timer wheel schedules callbacks against the maze clock. Timers are kept in four levels of 64 slots each; the
+	first level holds timers due within 64 ticks, one slot per tick, and each higher level covers 64 times the span
+	of the one below. As time advances, the slots of a higher level are cascaded down into finer ones, so each tick
+	costs one slot (plus whatever timers actually expire) no matter how many timers are pending. Timers are pooled
+	and linked into their slots, so scheduling and cancelling are constant time as well.
+*/
+
+#ifndef VENGEANCE_TIMER_WHEEL_H
+#define VENGEANCE_TIMER_WHEEL_H
+
+#include <vector>
+
+// Called with the owner and subject given when the timer was scheduled
+typedef void (*timerCallback)(void * owner, void * subject);
+
+class vTimerWheel {
+private:
+	struct timerNode {
+		long long expiry;	// Tick
+		timerCallback callback;
+		void * owner;
+		void * subject;
+		int prev, next;		// Within a slot, or (next only) the free list
+		int slot;			// -1 when free
+		int generation;		// Bumped on every reuse, so stale handles can't cancel a newer timer
+	};
+
+	// Data
+	double tickLength;		// Seconds
+	long long currentTick;
+	int numPending;
+	int freeList;
+	int heads[4 * 64];
+	std::vector<timerNode> nodes;
+
+	// Methods
+	void cascade(int level);
+	void link(int n);
+	void unlink(int n);
+	void release(int n);
+protected:
+public:
+	// Constructors
+	vTimerWheel(double tick=0.01);
+	~vTimerWheel();
+
+	// Accessors
+	int getNumPending();
+	double getTickLength();
+
+	// Methods
+	bool cancel(int handle);				// False if the timer already fired or was cancelled
+	int schedule(double when, timerCallback callback, void * owner, void * subject);	// Returns a handle
+	void advance(double time);				// Fires every timer due at or before time, in order
+	void clear();							// Drops every pending timer without firing it
+	void reset(double time);				// Drops every pending timer and restarts the clock at time
+};
+
+#endif
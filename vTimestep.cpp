@@ -0,0 +1,66 @@
+/*	Brian Kirkpatrick
+	Pac-Man: Vengeance
+	Timestep class
+	Begun Saturday, October 17th, 2026
+
+	The timestep class turns variable frame times into a whole number of fixed-length simulation ticks. Leftover time
+	is carried to the next frame, so the game runs at the same speed at any frame rate, and every tick sees exactly
+	the same dt, so a given seed and input stream always plays out the same way. After a long stall, catch-up is
+	capped and the rest of the backlog is dropped rather than letting slow ticks pile up behind each other. The
+	fraction of a tick left over is the alpha the renderer blends between the last two ticks with.
+*/
+
+#include "vTimestep.h"
+#include <math.h>
+
+// --- Constructors --- //
+
+vTimestep::vTimestep(double dt, int maxCatchUp) {
+	stepLength = dt > 0.0 ? dt : 0.01;
+	maxSteps = maxCatchUp > 0 ? maxCatchUp : 1;
+	accumulated = 0.0;
+	ticks = 0;
+}
+
+vTimestep::~vTimestep() {
+	// Nothing to destroy
+}
+
+// --- Accessors --- //
+
+float vTimestep::getAlpha() {
+	return (float)(accumulated / stepLength);
+}
+
+double vTimestep::getStepLength() {
+	return stepLength;
+}
+
+long long vTimestep::getTicks() {
+	return ticks;
+}
+
+void vTimestep::setMaxSteps(int n) {
+	maxSteps = n > 0 ? n : 1;
+}
+
+// --- Methods --- //
+
+int vTimestep::advance(double elapsed) {
+	if (elapsed > 0.0) accumulated += elapsed;
+	int steps = (int)(accumulated / stepLength);
+	if (steps > maxSteps) {
+		// Spiral of death: drop whatever can't be caught up this frame, keeping the partial tick
+		steps = maxSteps;
+		accumulated = fmod(accumulated, stepLength);
+	} else {
+		accumulated -= stepLength * steps;
+	}
+	if (accumulated < 0.0) accumulated = 0.0;
+	ticks += steps;
+	return steps;
+}
+
+void vTimestep::reset() {
+	accumulated = 0.0;
+}
@@ -0,0 +1,40 @@
+/*	Brian Kirkpatrick
+	Pac-Man: Vengeance
+	Timestep class
+	Begun Saturday, October 17th, 2026
+
+	The timestep class turns variable frame times into a whole number of fixed-length simulation ticks. Leftover time
+	is carried to the next frame, so the game runs at the same speed at any frame rate, and every tick sees exactly
+	the same dt, so a given seed and input stream always plays out the same way. After a long stall, catch-up is
+	capped and the rest of the backlog is dropped rather than letting slow ticks pile up behind each other. The
+	fraction of a tick left over is the alpha the renderer blends between the last two ticks with.
+*/
+
+#ifndef VENGEANCE_TIMESTEP_H
+#define VENGEANCE_TIMESTEP_H
+
+class vTimestep {
+private:
+	// Data
+	double stepLength;		// Seconds per tick
+	double accumulated;		// Seconds not yet simulated
+	int maxSteps;			// Most ticks run for a single frame
+	long long ticks;		// Ticks handed out so far
+protected:
+public:
+	// Constructors
+	vTimestep(double dt=0.01, int maxCatchUp=10);
+	~vTimestep();
+
+	// Accessors
+	float getAlpha();		// 0-1; progress from the last tick towards the next
+	double getStepLength();
+	long long getTicks();
+	void setMaxSteps(int n);
+
+	// Methods
+	int advance(double elapsed);	// Adds elapsed seconds of wall time; returns the number of ticks to run now
+	void reset();
+};
+
+#endif
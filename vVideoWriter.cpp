@@ -0,0 +1,121 @@
+/*	Brian Kirkpatrick
+	Pac-Man: Vengeance
+	Video writer class
+	Begun Saturday, October 17th, 2026
+
+	The video writer streams frames to a file (or standard output) uncompressed, either as YUV4MPEG2 (4:2:0, BT.601
+	studio range, which ffmpeg and most players read directly) or as raw RGBA frames back to back. Frames must all be
+	the size given when the stream was opened.
+*/
+
+#include "vVideoWriter.h"
+#include <string.h>
+
+// BT.601 studio range, in 8.8 fixed point
+static unsigned char lumaOf(int r, int g, int b) {
+	return (unsigned char)(((66 * r + 129 * g + 25 * b + 128) >> 8) + 16);
+}
+
+static unsigned char blueOf(int r, int g, int b) {
+	return (unsigned char)(((-38 * r - 74 * g + 112 * b + 128) >> 8) + 128);
+}
+
+static unsigned char redOf(int r, int g, int b) {
+	return (unsigned char)(((112 * r - 94 * g - 18 * b + 128) >> 8) + 128);
+}
+
+// --- Constructors --- //
+
+vVideoWriter::vVideoWriter() {
+	file = NULL;
+	ownsFile = false;
+	format = VF_Y4M;
+	width = 0;
+	height = 0;
+	numFrames = 0;
+}
+
+vVideoWriter::~vVideoWriter() {
+	close();
+}
+
+// --- Accessors --- //
+
+int vVideoWriter::getNumFrames() {
+	return numFrames;
+}
+
+// --- Methods --- //
+
+void vVideoWriter::close() {
+	if (file != NULL) {
+		if (ownsFile) {
+			fclose(file);
+		} else {
+			fflush(file);
+		}
+		file = NULL;
+	}
+}
+
+bool vVideoWriter::open(const char * filename, int w, int h, int fps, videoFormat f) {
+	close();
+	if (w <= 0 || h <= 0) return false;
+	if (strcmp(filename, "-") == 0) {
+		file = stdout;
+		ownsFile = false;
+	} else {
+		file = fopen(filename, "wb");
+		ownsFile = true;
+	}
+	if (file == NULL) return false;
+	format = f;
+	width = w;
+	height = h;
+	numFrames = 0;
+	if (format == VF_Y4M) {
+		fprintf(file, "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C420jpeg\n", width, height, fps > 0 ? fps : 1);
+	}
+	return true;
+}
+
+bool vVideoWriter::write(vImage * frame) {
+	if (file == NULL || frame->getWidth() != width || frame->getHeight() != height) return false;
+	if (format == VF_RGBA) {
+		numFrames++;
+		return fwrite(frame->getPixels(), 4, (size_t)width * height, file) == (size_t)width * height;
+	}
+
+	// Luma per pixel; chroma per 2x2 block, from the block's average color
+	int chromaW = (width + 1) / 2;
+	int chromaH = (height + 1) / 2;
+	size_t lumaSize = (size_t)width * height;
+	size_t chromaSize = (size_t)chromaW * chromaH;
+	planes.resize(lumaSize + 2 * chromaSize);
+	unsigned char * luma = &planes[0];
+	unsigned char * blue = luma + lumaSize;
+	unsigned char * red = blue + chromaSize;
+	for (int y = 0; y < height; y++) {
+		const unsigned char * p = frame->getRow(y);
+		unsigned char * out = luma + (size_t)y * width;
+		for (int x = 0; x < width; x++) {
+			out[x] = lumaOf(p[0], p[1], p[2]);
+			p += 4;
+		}
+	}
+	for (int cy = 0; cy < chromaH; cy++) {
+		const unsigned char * top = frame->getRow(2 * cy);
+		const unsigned char * bottom = frame->getRow(2 * cy + 1 < height ? 2 * cy + 1 : 2 * cy);
+		for (int cx = 0; cx < chromaW; cx++) {
+			int x0 = 4 * (2 * cx);
+			int x1 = 4 * (2 * cx + 1 < width ? 2 * cx + 1 : 2 * cx);
+			int r = (top[x0] + top[x1] + bottom[x0] + bottom[x1] + 2) / 4;
+			int g = (top[x0 + 1] + top[x1 + 1] + bottom[x0 + 1] + bottom[x1 + 1] + 2) / 4;
+			int b = (top[x0 + 2] + top[x1 + 2] + bottom[x0 + 2] + bottom[x1 + 2] + 2) / 4;
+			blue[(size_t)cy * chromaW + cx] = blueOf(r, g, b);
+			red[(size_t)cy * chromaW + cx] = redOf(r, g, b);
+		}
+	}
+	numFrames++;
+	return fputs("FRAME\n", file) >= 0 && fwrite(&planes[0], 1, planes.size(), file) == planes.size();
+}
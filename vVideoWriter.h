@@ -0,0 +1,44 @@
+/*	Brian Kirkpatrick
+	Pac-Man: Vengeance
+	Video writer class
+	Begun Saturday, October 17th, 2026
+
+	The video writer streams frames to a file (or standard output) uncompressed, either as YUV4MPEG2 (4:2:0, BT.601
+	studio range, which ffmpeg and most players read directly) or as raw RGBA frames back to back. Frames must all be
+	the size given when the stream was opened.
+*/
+
+#ifndef VENGEANCE_VIDEO_WRITER_H
+#define VENGEANCE_VIDEO_WRITER_H
+
+#include "vImage.h"
+#include <stdio.h>
+#include <vector>
+
+enum videoFormat { VF_Y4M, VF_RGBA };
+
+class vVideoWriter {
+private:
+	// Data
+	FILE * file;
+	bool ownsFile;		// False when writing to standard output
+	videoFormat format;
+	int width, height;
+	int numFrames;
+	std::vector<unsigned char> planes;	// Y, then U, then V, for the frame being written
+protected:
+public:
+	// Constructors
+	vVideoWriter();
+	~vVideoWriter();		// Closes the stream
+
+	// Accessors
+	int getNumFrames();
+
+	// Methods
+	void close();
+	bool open(const char * filename, int w, int h, int fps, videoFormat f);	// "-" is standard output
+	bool write(vImage * frame);
+};
+
+#endif